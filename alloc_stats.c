@@ -0,0 +1,23 @@
+#include "alloc_stats.h"
+#include <stdlib.h>
+
+static alloc_stats_t stats;
+
+void *tracked_malloc(size_t size) {
+  void *ptr = malloc(size);
+  if (ptr != NULL) {
+    stats.allocs++;
+    stats.bytes += size;
+  }
+  return ptr;
+}
+
+void tracked_free(void *ptr) {
+  if (ptr == NULL) return;
+  stats.frees++;
+  free(ptr);
+}
+
+const alloc_stats_t *alloc_stats() {
+  return &stats;
+}
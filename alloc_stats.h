@@ -0,0 +1,38 @@
+#ifndef _ALLOC_STATS_H_
+#define _ALLOC_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Heap counters of the game's own allocations
+ */
+typedef struct {
+  uint32_t allocs; /* Successful tracked_malloc calls */
+  uint32_t frees;  /* tracked_free calls with a non-NULL pointer */
+  uint64_t bytes;  /* Bytes requested by all allocations */
+} alloc_stats_t;
+
+/**
+ * @brief malloc that is counted in the allocation statistics
+ *
+ * @param size Bytes to allocate
+ * @return Memory, NULL if out of memory
+ */
+void *tracked_malloc(size_t size);
+
+/**
+ * @brief free for memory returned by tracked_malloc
+ *
+ * @param ptr Memory (NULL is ignored)
+ */
+void tracked_free(void *ptr);
+
+/**
+ * @brief Get the allocation statistics
+ *
+ * @return Counters since startup
+ */
+const alloc_stats_t *alloc_stats();
+
+#endif /* _ALLOC_STATS_H_ */
@@ -0,0 +1,175 @@
+#include "dictionary.h"
+#include "alloc_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* Places the dictionary file is looked for, like leaderboard.txt */
+static const char *dict_paths[] = {
+  DICT_FILE,
+  "../" DICT_FILE,
+  "/home/lcom/labs/grupo_2leic10_2/proj/src/" DICT_FILE,
+};
+
+/* Loaded image */
+static size_t image_size = 0;
+static const dict_header_t *header = NULL;
+static const dict_category_t *categories = NULL;
+static const dict_word_t *word_table = NULL;
+static const char *pool = NULL;
+
+/* How the image is owned */
+static void *mapped = NULL;  /* mmap'ed file */
+static size_t mapped_size = 0;
+static void *owned = NULL;   /* malloc'ed copy */
+
+/* Map a file read-only, falling back to reading it when mmap is not available */
+static int load_file(const char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return 1;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(dict_header_t)) {
+    close(fd);
+    return 1;
+  }
+  size_t size = (size_t) st.st_size;
+
+  void *p = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (p != MAP_FAILED) {
+    close(fd);
+    if (dictionary_use_image(p, size) != 0) {
+      munmap(p, size);
+      return 1;
+    }
+    mapped = p;
+    mapped_size = size;
+    printf("dictionary_load(): mapped %s (%u bytes)\n", path, (unsigned) size);
+    return 0;
+  }
+
+  /* No mmap: one read into a private copy */
+  void *copy = tracked_malloc(size);
+  ssize_t n = copy != NULL ? read(fd, copy, size) : -1;
+  close(fd);
+  if (n != (ssize_t) size || dictionary_use_image(copy, size) != 0) {
+    tracked_free(copy);
+    return 1;
+  }
+  owned = copy;
+  printf("dictionary_load(): read %s (%u bytes)\n", path, (unsigned) size);
+  return 0;
+}
+
+int dictionary_load() {
+  dictionary_unload();
+
+  for (size_t i = 0; i < sizeof(dict_paths) / sizeof(dict_paths[0]); i++) {
+    if (load_file(dict_paths[i]) == 0) return 0;
+  }
+
+  /* The built-in image is used in place, like a mapped file */
+  if (dictionary_use_image(dictionary_data, dictionary_data_size) != 0) {
+    printf("dictionary_load(): no dictionary available\n");
+    return 1;
+  }
+  printf("dictionary_load(): %s not found, using built-in words (%u bytes)\n", DICT_FILE,
+         (unsigned) dictionary_data_size);
+  return 0;
+}
+
+void dictionary_unload() {
+  if (mapped != NULL) munmap(mapped, mapped_size);
+  tracked_free(owned);
+  mapped = NULL;
+  mapped_size = 0;
+  owned = NULL;
+  image_size = 0;
+  header = NULL;
+  categories = NULL;
+  word_table = NULL;
+  pool = NULL;
+}
+
+/* Bounds check of a table inside the image, in 64 bits so it cannot wrap */
+static bool table_fits(uint32_t offset, uint64_t count, size_t elem, size_t size) {
+  return offset % 4 == 0 && (uint64_t) offset + count * elem <= size;
+}
+
+int dictionary_use_image(const void *data, size_t size) {
+  const dict_header_t *h = data;
+  if (data == NULL || size < sizeof(dict_header_t) || (uintptr_t) data % 4 != 0) return 1;
+
+  if (h->magic != DICT_MAGIC || h->version != DICT_VERSION || h->file_size > size) {
+    printf("dictionary_use_image(): bad header\n");
+    return 1;
+  }
+  if (!table_fits(h->categories_offset, h->category_count, sizeof(dict_category_t), h->file_size) ||
+      !table_fits(h->words_offset, h->word_count, sizeof(dict_word_t), h->file_size) ||
+      !table_fits(h->pool_offset, h->pool_size, 1, h->file_size) ||
+      h->pool_size == 0 || h->category_count == 0) {
+    printf("dictionary_use_image(): tables out of bounds\n");
+    return 1;
+  }
+
+  const uint8_t *base = data;
+  const dict_category_t *cats = (const dict_category_t *) (base + h->categories_offset);
+  const dict_word_t *words = (const dict_word_t *) (base + h->words_offset);
+  const char *strings = (const char *) (base + h->pool_offset);
+
+  /* Every string must end inside the pool */
+  size_t last = h->pool_size;
+  while (last > 0 && strings[last - 1] != '\0') last--;
+  if (last == 0) {
+    printf("dictionary_use_image(): unterminated string pool\n");
+    return 1;
+  }
+
+  for (uint32_t c = 0; c < h->category_count; c++) {
+    if (cats[c].name >= last || cats[c].word_count > DICT_MAX_CATEGORY_WORDS ||
+        (uint64_t) cats[c].first_word + cats[c].word_count > h->word_count) {
+      printf("dictionary_use_image(): bad category %u\n", c);
+      return 1;
+    }
+  }
+  for (uint32_t w = 0; w < h->word_count; w++) {
+    if (words[w].text >= last || words[w].key >= last || words[w].key_len > DICT_MAX_KEY) {
+      printf("dictionary_use_image(): bad word %u\n", w);
+      return 1;
+    }
+  }
+
+  image_size = h->file_size;
+  header = h;
+  categories = cats;
+  word_table = words;
+  pool = strings;
+  return 0;
+}
+
+int dictionary_category_count() {
+  return header != NULL ? (int) header->category_count : 0;
+}
+
+const dict_category_t *dictionary_category(int index) {
+  if (header == NULL || index < 0 || (uint32_t) index >= header->category_count) return NULL;
+  return &categories[index];
+}
+
+const dict_word_t *dictionary_word(const dict_category_t *category, int index) {
+  if (category == NULL || index < 0 || (uint32_t) index >= category->word_count) return NULL;
+  return &word_table[category->first_word + index];
+}
+
+const char *dictionary_string(uint32_t offset) {
+  if (header == NULL || offset >= header->pool_size) return "";
+  return pool + offset;
+}
+
+size_t dictionary_size() {
+  return image_size;
+}
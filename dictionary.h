@@ -0,0 +1,125 @@
+#ifndef _DICTIONARY_H_
+#define _DICTIONARY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Dictionary image, used in place (memory mapped from disk or compiled in).
+ * All integers are little-endian, all offsets are from the start of the image:
+ *
+ *   dict_header_t
+ *   dict_category_t[category_count]
+ *   dict_word_t[word_count]        words of a category are contiguous
+ *   string pool                    NUL-terminated strings, each stored once
+ */
+
+#define DICT_MAGIC 0x31434944   /* "DIC1" */
+#define DICT_VERSION 1
+#define DICT_FILE "dicionario.bin"
+#define DICT_MAX_CATEGORY_WORDS 4096  /* Largest category the game accepts */
+#define DICT_MAX_KEY 63               /* Longest normalized word */
+
+/**
+ * @brief Image header
+ */
+typedef struct {
+  uint32_t magic;             /* DICT_MAGIC */
+  uint32_t version;           /* DICT_VERSION */
+  uint32_t file_size;         /* Size of the whole image */
+  uint32_t category_count;
+  uint32_t word_count;        /* Words in all categories */
+  uint32_t categories_offset; /* dict_category_t table */
+  uint32_t words_offset;      /* dict_word_t table */
+  uint32_t pool_offset;       /* String pool */
+  uint32_t pool_size;
+} dict_header_t;
+
+/**
+ * @brief Category record
+ */
+typedef struct {
+  uint32_t name;        /* Pool offset of the category name */
+  uint32_t first_word;  /* Index of the first word in the word table */
+  uint32_t word_count;  /* Words in the category */
+  uint32_t reserved;
+} dict_category_t;
+
+/**
+ * @brief Word record
+ */
+typedef struct {
+  uint32_t text;     /* Pool offset of the word as shown to the player */
+  uint32_t key;      /* Pool offset of the normalized key (lowercase, no accents) */
+  uint32_t letters;  /* Letters of the key, bit 0 = 'a' */
+  uint16_t score;    /* Points awarded for the word */
+  uint8_t key_len;   /* strlen(key) */
+  uint8_t flags;     /* Reserved */
+} dict_word_t;
+
+/**
+ * @brief Map the dictionary file, falling back to the built-in words
+ *
+ * @return 0 on success, 1 if no dictionary is available
+ */
+int dictionary_load();
+
+/**
+ * @brief Release the dictionary image
+ */
+void dictionary_unload();
+
+/**
+ * @brief Check and adopt an image already in memory (not copied)
+ *
+ * @param image Dictionary image
+ * @param size Image size in bytes
+ * @return 0 on success, 1 if the image is malformed
+ */
+int dictionary_use_image(const void *image, size_t size);
+
+/**
+ * @brief Get the number of categories
+ *
+ * @return Number of categories (0 if no dictionary is loaded)
+ */
+int dictionary_category_count();
+
+/**
+ * @brief Get a category
+ *
+ * @param index Category index
+ * @return Category record, NULL if index is out of range
+ */
+const dict_category_t *dictionary_category(int index);
+
+/**
+ * @brief Get a word of a category
+ *
+ * @param category Category record
+ * @param index Word index inside the category
+ * @return Word record, NULL if index is out of range
+ */
+const dict_word_t *dictionary_word(const dict_category_t *category, int index);
+
+/**
+ * @brief Get a string from the pool
+ *
+ * @param offset Pool offset stored in a record
+ * @return NUL-terminated string ("" if offset is out of range)
+ */
+const char *dictionary_string(uint32_t offset);
+
+/**
+ * @brief Get the size of the dictionary image
+ *
+ * @return Bytes used by the loaded image
+ */
+size_t dictionary_size();
+
+/* Built-in image, generated into dictionary_data.c by tools/dict_convert */
+extern const uint32_t dictionary_data[];
+extern const size_t dictionary_data_size;
+
+#endif /* _DICTIONARY_H_ */
@@ -0,0 +1,283 @@
+/* Generated by tools/dict_convert from dicionarios.h - do not edit */
+#include "dictionary.h"
+
+const uint32_t dictionary_data[2204] = {
+  0x31434944, 0x00000001, 0x00002270, 0x00000019, 0x0000012c, 0x00000024, 0x000001b4, 0x00001474,
+  0x00000dfc, 0x00000000, 0x00000000, 0x0000000c, 0x00000000, 0x0000006d, 0x0000000c, 0x0000000c,
+  0x00000000, 0x000000c9, 0x00000018, 0x0000000c, 0x00000000, 0x00000128, 0x00000024, 0x0000000c,
+  0x00000000, 0x000001b5, 0x00000030, 0x0000000c, 0x00000000, 0x00000222, 0x0000003c, 0x0000000c,
+  0x00000000, 0x00000294, 0x00000048, 0x0000000c, 0x00000000, 0x00000344, 0x00000054, 0x0000000c,
+  0x00000000, 0x000003c2, 0x00000060, 0x0000000c, 0x00000000, 0x00000421, 0x0000006c, 0x0000000c,
+  0x00000000, 0x000004a4, 0x00000078, 0x0000000c, 0x00000000, 0x00000558, 0x00000084, 0x0000000c,
+  0x00000000, 0x000005a2, 0x00000090, 0x0000000c, 0x00000000, 0x00000617, 0x0000009c, 0x0000000c,
+  0x00000000, 0x000006d1, 0x000000a8, 0x0000000c, 0x00000000, 0x00000749, 0x000000b4, 0x0000000c,
+  0x00000000, 0x000007b1, 0x000000c0, 0x0000000c, 0x00000000, 0x0000083c, 0x000000cc, 0x0000000c,
+  0x00000000, 0x0000092f, 0x000000d8, 0x0000000c, 0x00000000, 0x000009ec, 0x000000e4, 0x0000000c,
+  0x00000000, 0x00000aa6, 0x000000f0, 0x0000000c, 0x00000000, 0x00000b70, 0x000000fc, 0x0000000c,
+  0x00000000, 0x00000c43, 0x00000108, 0x0000000c, 0x00000000, 0x00000d1d, 0x00000114, 0x0000000c,
+  0x00000000, 0x00000da5, 0x00000120, 0x0000000c, 0x00000000, 0x0000000d, 0x0000000d, 0x00026311,
+  0x00070001, 0x00000015, 0x00000015, 0x00224130, 0x00090002, 0x0000001f, 0x00000026, 0x00025005,
+  0x00050001, 0x0000002c, 0x0000002c, 0x00020903, 0x00050001, 0x00000032, 0x00000032, 0x00005101,
+  0x00040002, 0x00000037, 0x00000037, 0x00106280, 0x00050001, 0x0000003d, 0x0000003d, 0x00104a80,
+  0x00050002, 0x00000043, 0x00000043, 0x000c4041, 0x00060003, 0x0000004a, 0x0000004a, 0x000e5012,
+  0x00080003, 0x00000053, 0x00000053, 0x001a4002, 0x00070003, 0x0000005b, 0x0000005b, 0x00227012,
+  0x00080002, 0x00000064, 0x00000064, 0x0202501a, 0x00080003, 0x00000073, 0x00000073, 0x00225890,
+  0x00080002, 0x0000007c, 0x0000007c, 0x02100801, 0x00040001, 0x00000081, 0x00000081, 0x00220018,
+  0x00050001, 0x00000087, 0x00000087, 0x00025811, 0x00070002, 0x0000008f, 0x0000008f, 0x00824000,
+  0x00040002, 0x00000094, 0x00000094, 0x00022a01, 0x00070002, 0x0000009c, 0x0000009c, 0x000ac010,
+  0x00050001, 0x000000a2, 0x000000a2, 0x00026007, 0x00060001, 0x000000a9, 0x000000a9, 0x02086114,
+  0x00080002, 0x000000b2, 0x000000b2, 0x00064001, 0x00040001, 0x000000b7, 0x000000b7, 0x000c6085,
+  0x00080003, 0x000000c0, 0x000000c0, 0x001f0011, 0x00080003, 0x000000d0, 0x000000d7, 0x00001005,
+  0x00040001, 0x000000dc, 0x000000dc, 0x00002003, 0x00060001, 0x00000094, 0x00000094, 0x00022a01,
+  0x00070001, 0x000000e3, 0x000000e3, 0x00003915, 0x00080003, 0x000000ec, 0x000000ec, 0x00028011,
+  0x00040001, 0x000000f1, 0x000000f1, 0x00300001, 0x00030001, 0x000000f5, 0x000000f5, 0x00400500,
+  0x00040002, 0x000000fa, 0x000000fa, 0x00003041, 0x00050002, 0x00000100, 0x00000100, 0x00020215,
+  0x00060002, 0x00000107, 0x0000010f, 0x00042001, 0x00060002, 0x00000116, 0x00000116, 0x00027041,
+  0x00070002, 0x0000011e, 0x0000011e, 0x00065033, 0x00090003, 0x00000134, 0x0000013c, 0x0000511c,
+  0x00060002, 0x00000143, 0x00000143, 0x00204049, 0x00080003, 0x0000014c, 0x0000014c, 0x0006c030,
+  0x00090002, 0x00000156, 0x00000156, 0x000261d0, 0x000a0003, 0x00000161, 0x00000161, 0x00025112,
+  0x00080002, 0x0000016a, 0x00000173, 0x0000c905, 0x00070002, 0x0000017b, 0x0000017b, 0x0002c119,
+  0x00070001, 0x00000183, 0x00000183, 0x000e5101, 0x00090001, 0x0000018d, 0x0000018d, 0x001b4111,
+  0x00090003, 0x00000197, 0x00000197, 0x000c2115, 0x00090003, 0x000001a1, 0x000001a1, 0x000c2119,
+  0x00080002, 0x000001aa, 0x000001aa, 0x00027130, 0x000a0002, 0x000001bd, 0x000001bd, 0x00100801,
+  0x00030001, 0x000001c1, 0x000001c1, 0x00044800, 0x00030001, 0x000001c5, 0x000001c5, 0x000a0011,
+  0x00050001, 0x000001cb, 0x000001cb, 0x000a1011, 0x00050002, 0x000001d1, 0x000001da, 0x001a8310,
+  0x00070002, 0x000001e2, 0x000001e2, 0x001e6001, 0x00070002, 0x000001ea, 0x000001ea, 0x00126001,
+  0x00050002, 0x000001f0, 0x000001f0, 0x0018e010, 0x00070002, 0x000001f8, 0x000001f8, 0x000e0811,
+  0x00070001, 0x00000200, 0x00000209, 0x00800941, 0x00070003, 0x00000211, 0x00000211, 0x00085015,
+  0x00060002, 0x00000218, 0x00000218, 0x000a5110, 0x00090003, 0x0000022a, 0x0000022f, 0x00004005,
+  0x00030001, 0x00000233, 0x00000233, 0x00084041, 0x00040001, 0x00000238, 0x00000238, 0x00082831,
+  0x00080003, 0x00000241, 0x00000247, 0x00004811, 0x00040002, 0x0000024c, 0x0000024c, 0x000a0150,
+  0x00050002, 0x00000252, 0x00000252, 0x00164000, 0x00040002, 0x00000257, 0x00000257, 0x00020161,
+  0x00060002, 0x0000025e, 0x0000025e, 0x02020013, 0x00050001, 0x00000264, 0x00000264, 0x000a6114,
+  0x000b0003, 0x00000270, 0x0000027c, 0x0008d181, 0x000a0003, 0x00000287, 0x00000287, 0x00004802,
+  0x00040001, 0x0000028c, 0x0000028c, 0x0010b140, 0x00070002, 0x000002a5, 0x000002a5, 0x001ac841,
+  0x00080001, 0x000002ae, 0x000002ae, 0x0004a091, 0x00070001, 0x000002b6, 0x000002be, 0x00022025,
+  0x00060001, 0x000002c5, 0x000002cd, 0x00080901, 0x00060001, 0x000002d4, 0x000002d4, 0x00003891,
+  0x00080002, 0x000002dd, 0x000002e6, 0x0000e901, 0x00070002, 0x000002ee, 0x000002f6, 0x00020155,
+  0x00060001, 0x000002fd, 0x000002fd, 0x00126051, 0x00070002, 0x00000305, 0x0000030d, 0x00140115,
+  0x00060002, 0x00000314, 0x0000031f, 0x00002929, 0x00090003, 0x00000329, 0x00000329, 0x0002310d,
+  0x00090002, 0x00000333, 0x0000033c, 0x00027111, 0x00070002, 0x0000035a, 0x0000035a, 0x001a0141,
+  0x00080002, 0x00000363, 0x00000363, 0x0000e101, 0x00050002, 0x00000369, 0x00000369, 0x00206900,
+  0x00070003, 0x00000371, 0x00000371, 0x000a0113, 0x00070002, 0x00000379, 0x00000379, 0x00846031,
+  0x00080003, 0x00000382, 0x00000382, 0x000ad010, 0x00080002, 0x0000038b, 0x0000038b, 0x00180821,
+  0x00060001, 0x00000392, 0x00000392, 0x00028081, 0x00050002, 0x00000398, 0x000003a2, 0x0002401d,
+  0x00080003, 0x000003ab, 0x000003ab, 0x000a2915, 0x00090003, 0x000003b5, 0x000003b5, 0x000a5003,
+  0x00060001, 0x000003bc, 0x000003bc, 0x00804103, 0x00050001, 0x000003d3, 0x000003d3, 0x01084001,
+  0x00060001, 0x000003da, 0x000003da, 0x00401002, 0x00030002, 0x000003de, 0x000003de, 0x00100109,
+  0x00040002, 0x000003e3, 0x000003e3, 0x0006101c, 0x00080002, 0x000003ec, 0x000003ec, 0x00024028,
+  0x00040001, 0x000003f1, 0x000003f1, 0x00646c51, 0x000a0002, 0x000003fc, 0x000003fc, 0x001a2811,
+  0x00070001, 0x00000404, 0x00000404, 0x0018c050, 0x00070001, 0x0000040c, 0x0000040c, 0x00006089,
+  0x00050001, 0x00000412, 0x00000412, 0x00080121, 0x00040001, 0x00000417, 0x00000417, 0x02001009,
+  0x00050002, 0x0000041d, 0x0000041d, 0x00000501, 0x00030001, 0x00000435, 0x00000435, 0x00044903,
+  0x00060001, 0x0000043c, 0x0000043c, 0x000ac000, 0x00050001, 0x00000442, 0x00000442, 0x00025107,
+  0x00070001, 0x0000044a, 0x0000044a, 0x00020043, 0x00050001, 0x00000450, 0x00000450, 0x00224111,
+  0x00060001, 0x00000457, 0x00000457, 0x00024021, 0x00040001, 0x0000045c, 0x00000467, 0x00161151,
+  0x00090002, 0x00000471, 0x00000471, 0x00340110, 0x00050001, 0x00000477, 0x00000477, 0x00020911,
+  0x00060001, 0x0000047e, 0x00000485, 0x00224011, 0x00050001, 0x0000048b, 0x00000494, 0x001c0813,
+  0x00070001, 0x0000049c, 0x0000049c, 0x00040105, 0x00070001, 0x000004b8, 0x000004c4, 0x000261d8,
+  0x000a0002, 0x000004cf, 0x000004d6, 0x00004990, 0x00050001, 0x000004dc, 0x000004e3, 0x00084900,
+  0x00050002, 0x000004e9, 0x000004e9, 0x00026007, 0x00070001, 0x000004f1, 0x000004fb, 0x00806150,
+  0x00080001, 0x00000504, 0x0000050b, 0x00044108, 0x00050002, 0x00000511, 0x0000051b, 0x00047151,
+  0x00080003, 0x00000524, 0x00000524, 0x00826030, 0x00070002, 0x0000052c, 0x0000052c, 0x00024030,
+  0x00050001, 0x00000532, 0x00000532, 0x02006104, 0x00050002, 0x00000538, 0x00000540, 0x00126101,
+  0x00060003, 0x00000547, 0x00000550, 0x00026109, 0x00070003, 0x00000561, 0x0000056b, 0x00125114,
+  0x00080002, 0x00000574, 0x0000057b, 0x00342010, 0x00050001, 0x000001c5, 0x000001c5, 0x000a0011,
+  0x00050001, 0x000001cb, 0x000001cb, 0x000a1011, 0x00050002, 0x000001d1, 0x000001da, 0x001a8310,
+  0x00070002, 0x000001e2, 0x000001e2, 0x001e6001, 0x00070002, 0x000001ea, 0x000001ea, 0x00126001,
+  0x00050002, 0x000001f0, 0x000001f0, 0x0018e010, 0x00070002, 0x00000581, 0x00000589, 0x0018c801,
+  0x00060002, 0x00000590, 0x00000590, 0x00060014, 0x00050003, 0x00000596, 0x00000596, 0x00060110,
+  0x00040003, 0x0000059b, 0x0000059b, 0x00101091, 0x00060003, 0x00000435, 0x00000435, 0x00044903,
+  0x00060001, 0x000005b5, 0x000005b5, 0x00068101, 0x00050001, 0x000005bb, 0x000005bb, 0x00025001,
+  0x00040001, 0x000005c0, 0x000005c0, 0x00021912, 0x00060002, 0x000005c7, 0x000005c7, 0x00021109,
+  0x00060001, 0x000005ce, 0x000005ce, 0x00044800, 0x00040002, 0x000005d3, 0x000005df, 0x00152991,
+  0x000a0003, 0x000005ea, 0x000005ea, 0x00022005, 0x00060002, 0x000005f1, 0x000005f1, 0x00100807,
+  0x00050002, 0x000005f7, 0x000005ff, 0x000a4011, 0x00060003, 0x00000606, 0x00000606, 0x0000e0d5,
+  0x00090003, 0x00000610, 0x00000610, 0x00005007, 0x00060003, 0x0000062b, 0x0000062b, 0x00100887,
+  0x00080001, 0x00000634, 0x00000634, 0x0200410c, 0x00060001, 0x0000063b, 0x0000063b, 0x00004339,
+  0x00080002, 0x00000644, 0x00000644, 0x0022481d, 0x000b0002, 0x00000650, 0x00000650, 0x020ac019,
+  0x000d0003, 0x0000065e, 0x00000676, 0x000ed109, 0x00160003, 0x0000068d, 0x0000068d, 0x000621b5,
+  0x000b0002, 0x00000699, 0x00000699, 0x00062189, 0x00090001, 0x000006a3, 0x000006a3, 0x000ca819,
+  0x000e0001, 0x000006b2, 0x000006ba, 0x00084911, 0x00060002, 0x000006c1, 0x000006c1, 0x0002400b,
+  0x00070002, 0x000006c9, 0x000006c9, 0x00020991, 0x00070001, 0x000006dd, 0x000006dd, 0x000a5811,
+  0x00070001, 0x000006e5, 0x000006e5, 0x002420bd, 0x000f0002, 0x000006f5, 0x000006f5, 0x000e4010,
+  0x00070001, 0x000006fd, 0x000006fd, 0x00080915, 0x00070001, 0x00000705, 0x00000705, 0x00120139,
+  0x00090002, 0x0000070f, 0x0000070f, 0x0016c021, 0x00080001, 0x00000718, 0x00000720, 0x00025021,
+  0x00060002, 0x00000727, 0x00000727, 0x00001901, 0x00040001, 0x0000072c, 0x0000072c, 0x000a2011,
+  0x00050002, 0x00000732, 0x00000732, 0x000a6000, 0x00050002, 0x00000738, 0x00000738, 0x00202805,
+  0x00080003, 0x00000741, 0x00000741, 0x00061910, 0x00070003, 0x00000765, 0x00000765, 0x00000004,
+  0x00010001, 0x00000767, 0x00000767, 0x00200201, 0x00040001, 0x0000076c, 0x0000076c, 0x0108e080,
+  0x00060001, 0x00000773, 0x00000773, 0x00040c91, 0x00070003, 0x0000077b, 0x0000077b, 0x002e8305,
+  0x000a0002, 0x00000786, 0x00000786, 0x010e8114, 0x000a0003, 0x00000791, 0x00000791, 0x001e0000,
+  0x00040002, 0x00000796, 0x00000796, 0x00004040, 0x00020001, 0x00000799, 0x00000799, 0x004c0120,
+  0x00050002, 0x0000079f, 0x0000079f, 0x00086d00, 0x00060002, 0x000007a6, 0x000007a6, 0x00040805,
+  0x00050002, 0x000007ac, 0x000007ac, 0x00028810, 0x00040001, 0x000007bb, 0x000007bb, 0x00184832,
+  0x00070001, 0x000007c3, 0x000007c3, 0x001d4813, 0x000b0002, 0x000007cf, 0x000007cf, 0x0000681b,
+  0x00070002, 0x000007d7, 0x000007d7, 0x00204912, 0x00080002, 0x000007e0, 0x000007e0, 0x01120042,
+  0x00050002, 0x000007e6, 0x000007ed, 0x000c2110, 0x00050001, 0x000007f3, 0x000007f3, 0x00004870,
+  0x00050001, 0x000007f9, 0x000007f9, 0x00804012, 0x00040001, 0x000007fe, 0x00000808, 0x00086005,
+  0x00070001, 0x00000810, 0x00000810, 0x00061151, 0x00070003, 0x00000818, 0x00000823, 0x000c2145,
+  0x00090002, 0x0000082d, 0x00000835, 0x000a0411, 0x00060002, 0x0000084c, 0x00000857, 0x00086905,
+  0x00090002, 0x00000861, 0x0000086b, 0x0000c125, 0x00080002, 0x00000874, 0x0000087c, 0x0000610c,
+  0x00060002, 0x00000883, 0x0000088b, 0x000a4105, 0x00060002, 0x00000892, 0x0000089d, 0x000a6105,
+  0x00090003, 0x000008a7, 0x000008b5, 0x000a7119, 0x000c0003, 0x000008c2, 0x000008c2, 0x000a5001,
+  0x00090001, 0x000008cc, 0x000008d9, 0x000a5907, 0x000b0002, 0x000008e5, 0x000008e5, 0x000a7019,
+  0x000c0002, 0x000008f2, 0x000008f2, 0x00225891, 0x000c0002, 0x000008ff, 0x000008ff, 0x0002581d,
+  0x000c0003, 0x0000090c, 0x0000091e, 0x0006110f, 0x00100003, 0x0000093e, 0x00000948, 0x00024005,
+  0x00070001, 0x00000950, 0x00000959, 0x00024016, 0x00070002, 0x00000961, 0x0000096a, 0x0014d810,
+  0x00070001, 0x00000972, 0x0000097c, 0x000c5051, 0x00080001, 0x00000985, 0x0000098d, 0x00004169,
+  0x00060001, 0x00000994, 0x00000994, 0x00062100, 0x00040001, 0x00000999, 0x00000999, 0x000c6110,
+  0x00090002, 0x000009a3, 0x000009a9, 0x00004007, 0x00040003, 0x000009ae, 0x000009b8, 0x0006a015,
+  0x00080003, 0x000009c1, 0x000009ca, 0x00044071, 0x00070003, 0x000009d2, 0x000009d2, 0x001b0111,
+  0x00080002, 0x000009db, 0x000009e4, 0x000c6018, 0x00070002, 0x000009f8, 0x000009f8, 0x000ef091,
+  0x000a0001, 0x00000a03, 0x00000a03, 0x001ad00d, 0x000a0001, 0x00000a0e, 0x00000a0e, 0x00080813,
+  0x00060001, 0x00000a15, 0x00000a20, 0x00285810, 0x00090001, 0x00000a2a, 0x00000a2a, 0x000a2110,
+  0x00080001, 0x00000a33, 0x00000a33, 0x00400120, 0x00050001, 0x00000a39, 0x00000a39, 0x00184892,
+  0x00090002, 0x00000a43, 0x00000a4d, 0x000c0911, 0x00080002, 0x00000a56, 0x00000a56, 0x00066018,
+  0x00060001, 0x00000a5d, 0x00000a5d, 0x003a0919, 0x00110003, 0x00000a6f, 0x00000a88, 0x000a2975,
+  0x00170003, 0x00000aa0, 0x00000aa0, 0x00303010, 0x00050001, 0x00000ab5, 0x00000ac0, 0x00065131,
+  0x00090001, 0x00000aca, 0x00000ad3, 0x000e8110, 0x00070002, 0x00000adb, 0x00000ae5, 0x00046123,
+  0x00080002, 0x00000aee, 0x00000aee, 0x00848110, 0x00060001, 0x00000af5, 0x00000af5, 0x00240011,
+  0x00040001, 0x00000afa, 0x00000afa, 0x000c6110, 0x00070001, 0x00000b02, 0x00000b0e, 0x0006611d,
+  0x000a0002, 0x00000b19, 0x00000b19, 0x00145804, 0x00080002, 0x00000b22, 0x00000b2e, 0x001e4015,
+  0x000a0003, 0x00000b39, 0x00000b44, 0x0006610d, 0x00090003, 0x00000b4e, 0x00000b59, 0x00046919,
+  0x00090003, 0x00000b63, 0x00000b63, 0x00177118, 0x000c0003, 0x00000b7d, 0x00000b7d, 0x00082801,
+  0x00050001, 0x00000b83, 0x00000b8b, 0x0004c005, 0x00060001, 0x00000b92, 0x00000b92, 0x00206001,
+  0x00080001, 0x00000b9b, 0x00000b9b, 0x00222805, 0x00080001, 0x00000ba4, 0x00000ba4, 0x00406891,
+  0x00090002, 0x00000bae, 0x00000bae, 0x00067109, 0x00110002, 0x00000bc0, 0x00000bc0, 0x000a498b,
+  0x00120002, 0x00000bd3, 0x00000be3, 0x0002210d, 0x000e0001, 0x00000bf2, 0x00000bfe, 0x00001119,
+  0x000a0001, 0x00000c09, 0x00000c09, 0x0000c109, 0x000a0001, 0x00000c14, 0x00000c1f, 0x00044201,
+  0x00080001, 0x00000c28, 0x00000c36, 0x000e7181, 0x000c0002, 0x00000c57, 0x00000c57, 0x00144914,
+  0x00070001, 0x00000c5f, 0x00000c5f, 0x0012398d, 0x00100003, 0x00000c70, 0x00000c70, 0x000e611c,
+  0x000f0002, 0x00000c80, 0x00000c80, 0x00109185, 0x000c0003, 0x00000c8d, 0x00000c8d, 0x000a4930,
+  0x000c0001, 0x00000c9a, 0x00000c9a, 0x00002152, 0x00070001, 0x00000ca2, 0x00000ca2, 0x00081a81,
+  0x00090002, 0x00000cac, 0x00000cc0, 0x000ed159, 0x00120003, 0x00000cd3, 0x00000ce9, 0x001e091b,
+  0x00140002, 0x00000cfe, 0x00000cfe, 0x000c60d0, 0x000a0003, 0x00000d09, 0x00000d09, 0x000a8011,
+  0x00050002, 0x00000d0f, 0x00000d0f, 0x000ec119, 0x000d0001, 0x00000d34, 0x00000d34, 0x00000025,
+  0x00040001, 0x00000d39, 0x00000d39, 0x00024061, 0x00050001, 0x00000d3f, 0x00000d3f, 0x00024894,
+  0x00060001, 0x00000d46, 0x00000d46, 0x00084085, 0x00050001, 0x00000d4c, 0x00000d4c, 0x00020179,
+  0x000a0002, 0x00000d57, 0x00000d57, 0x0006401c, 0x000a0002, 0x00000d62, 0x00000d62, 0x000a011b,
+  0x00090002, 0x00000d6c, 0x00000d6c, 0x00024809, 0x00070002, 0x00000d74, 0x00000d74, 0x00006085,
+  0x00060001, 0x00000d7b, 0x00000d85, 0x001c8811, 0x00080001, 0x00000d8e, 0x00000d8e, 0x0006401d,
+  0x000b0003, 0x00000d9a, 0x00000d9a, 0x000e0813, 0x000a0002, 0x00000dba, 0x00000dba, 0x00060010,
+  0x00030001, 0x00000dbe, 0x00000dbe, 0x000e0011, 0x00050001, 0x00000dc4, 0x00000dc4, 0x000a0010,
+  0x00030001, 0x00000dc8, 0x00000dc8, 0x00020100, 0x00020001, 0x00000dcb, 0x00000dcb, 0x02020031,
+  0x00050001, 0x00000dd1, 0x00000dd1, 0x02020118, 0x00050002, 0x00000dd7, 0x00000dd7, 0x0002c018,
+  0x00050001, 0x00000ddd, 0x00000ddd, 0x00220010, 0x00030001, 0x00000de1, 0x00000de1, 0x00020009,
+  0x00030001, 0x00000de5, 0x00000de5, 0x00060013, 0x00050002, 0x00000deb, 0x00000deb, 0x00130010,
+  0x00060002, 0x00000df2, 0x00000df2, 0x000200d5, 0x00060001, 0x6573654d, 0x6f642073, 0x6f6e4120,
+  0x6e616a00, 0x6f726965, 0x76656600, 0x69657265, 0x6d006f72, 0xa7c37261, 0x616d006f, 0x006f6372,
+  0x69726261, 0x616d006c, 0x6a006f69, 0x6f686e75, 0x6c756a00, 0x61006f68, 0x74736f67, 0x6573006f,
+  0x626d6574, 0x6f006f72, 0x62757475, 0x6e006f72, 0x6d65766f, 0x006f7262, 0x657a6564, 0x6f72626d,
+  0x726f4300, 0x76007365, 0x656d7265, 0x006f686c, 0x6c757a61, 0x72657600, 0x61006564, 0x6572616d,
+  0x72006f6c, 0x006f786f, 0x6172616c, 0x00616a6e, 0x74657270, 0x7262006f, 0x6f636e61, 0x6e696300,
+  0x746e657a, 0x6f72006f, 0x63006173, 0x61747361, 0x006f686e, 0x71727574, 0x61736575, 0x75724600,
+  0x00736174, 0xa7c3616d, 0x6d00a3c3, 0x00616361, 0x616e6162, 0x6d00616e, 0x6e616c65, 0x00616963,
+  0x61726570, 0x61767500, 0x77696b00, 0x616d0069, 0x0061676e, 0x65726563, 0x6100616a, 0xc36e616e,
+  0x610073a1, 0x616e616e, 0x6f6d0073, 0x676e6172, 0x7266006f, 0x6f626d61, 0x00617365, 0x666f7250,
+  0xc3737369, 0x007365b5, 0x64a9c36d, 0x006f6369, 0x6964656d, 0x61006f63, 0x676f7664, 0x006f6461,
+  0x666f7270, 0x6f737365, 0x6e650072, 0x686e6567, 0x6f726965, 0x6d6f6200, 0x72696562, 0x6f70006f,
+  0x63adc36c, 0x70006169, 0x63696c6f, 0x70006169, 0x69656461, 0x6d006f72, 0x726f746f, 0x61747369,
+  0x71726100, 0x65746975, 0x63006f74, 0x746e6569, 0x61747369, 0x6e656400, 0x74736974, 0x6e650061,
+  0x6d726566, 0x6f726965, 0x70734500, 0x6fa7c361, 0x61756c00, 0x6c6f7300, 0x72657400, 0x6d006172,
+  0x65747261, 0xbac36a00, 0x65746970, 0x756a0072, 0x65746970, 0x61730072, 0x6e727574, 0x7275006f,
+  0x006f6e61, 0x7470656e, 0x006f6e75, 0x72747365, 0x00616c65, 0xc36c6167, 0x616978a1, 0x6c616700,
+  0x61697861, 0x6d6f6300, 0x00617465, 0x6574656d, 0x7469726f, 0x6e41006f, 0x69616d69, 0xc3630073,
+  0x63006fa3, 0x67006f61, 0x006f7461, 0x66656c65, 0x65746e61, 0xc3656c00, 0x6c006fa3, 0x006f6165,
+  0x72676974, 0x72750065, 0x67006f73, 0x66617269, 0x657a0061, 0x00617262, 0x6f6e6972, 0x6f726563,
+  0x0065746e, 0x6f706968, 0x74b3c370, 0x006f6d61, 0x6f706968, 0x61746f70, 0x6c006f6d, 0x006f626f,
+  0x676e6970, 0x006d6975, 0xadc36150, 0x20736573, 0x6f727545, 0x73756570, 0x726f7000, 0x61677574,
+  0x7365006c, 0x686e6170, 0x72660061, 0xa7c36e61, 0x72660061, 0x61636e61, 0xc3746900, 0x61696ca1,
+  0x61746900, 0x0061696c, 0x6d656c61, 0x61686e61, 0x6c6f7000, 0x696eb3c3, 0x6f700061, 0x696e6f6c,
+  0x72670061, 0x6963a9c3, 0x72670061, 0x61696365, 0x726f6e00, 0x61676575, 0xc3757300, 0x616963a9,
+  0x65757300, 0x00616963, 0x6c6e6966, 0x646ea2c3, 0x66006169, 0x616c6e69, 0x6169646e, 0x6e696400,
+  0x72616d61, 0x72006163, 0xa9c36d6f, 0x0061696e, 0x656d6f72, 0x0061696e, 0x74736e49, 0x656d7572,
+  0x736f746e, 0x73754d20, 0x69616369, 0x75670073, 0x72617469, 0x70006172, 0x6f6e6169, 0x6f697600,
+  0x6f6e696c, 0x74616200, 0x61697265, 0x78617300, 0x6e6f666f, 0x72740065, 0x65706d6f, 0x66006574,
+  0x7475616c, 0x61680061, 0x00617072, 0x726f6361, 0xa3c36564, 0x6361006f, 0x6564726f, 0x63006f61,
+  0x6972616c, 0x6574656e, 0x6d617400, 0x00726f62, 0x78696162, 0x614d006f, 0x73616372, 0x20656420,
+  0x72726143, 0x7400736f, 0x746f796f, 0x6d620061, 0x75610077, 0x6d006964, 0x65637265, 0x00736564,
+  0x64726f66, 0x6c6f7600, 0x6177736b, 0x006e6567, 0x616e6572, 0x00746c75, 0x67756570, 0x00746f65,
+  0x646e6f68, 0x69660061, 0x6d007461, 0x61647a61, 0x61696b00, 0x64694300, 0x73656461, 0x726f5020,
+  0x75677574, 0x73617365, 0x73696c00, 0x00616f62, 0x74726f70, 0x6f63006f, 0x72626d69, 0x72620061,
+  0x00616761, 0x69657661, 0x66006f72, 0x006f7261, 0x6d697567, 0xa3c37261, 0x67007365, 0x616d6975,
+  0x73656172, 0x73697600, 0x6c007565, 0x69726965, 0xa9c30061, 0x61726f76, 0x6f766500, 0x73006172,
+  0xbac37465, 0x006c6162, 0x75746573, 0x006c6162, 0x63736163, 0x00736961, 0x6d656c45, 0x6f746e65,
+  0x75512073, 0x696dadc3, 0x00736f63, 0x72646968, 0xa9c3676f, 0x006f696e, 0x72646968, 0x6e65676f,
+  0x68006f69, 0x696ca9c3, 0x6568006f, 0x006f696c, 0x74adc36c, 0x6c006f69, 0x6f697469, 0x72616300,
+  0x6f6e6f62, 0x69786f00, 0x6ea9c367, 0x6f006f69, 0x65676978, 0x006f696e, 0x64b3c373, 0x73006f69,
+  0x6f69646f, 0x67616d00, 0x73a9c36e, 0x6d006f69, 0x656e6761, 0x006f6973, 0x6f786e65, 0x00657266,
+  0x72726566, 0x697a006f, 0x006f636e, 0xa2c37275, 0x006f696e, 0x6e617275, 0x72006f69, 0xb4c36461,
+  0x006f696e, 0x6f646172, 0x006f696e, 0x6e616c50, 0x73617465, 0x72656d00, 0x72bac363, 0x6d006f69,
+  0x75637265, 0x006f6972, 0x6ea9c376, 0x76007375, 0x73756e65, 0x756c7000, 0x6fa3c374, 0x756c7000,
+  0x006f6174, 0x65726563, 0x72650073, 0x68007369, 0x656d7561, 0x61430061, 0x61746970, 0x2073656c,
+  0x4d206f64, 0x6f646e75, 0x72617000, 0x72007369, 0x00616d6f, 0x6c726562, 0x6d006d69, 0x69726461,
+  0x736f0064, 0x68006f6c, 0xc3736c65, 0x75716ead, 0x68006169, 0x69736c65, 0x6975716e, 0x6e610061,
+  0x61726163, 0x62616300, 0x74006c75, 0xc3726565, 0x74006fa3, 0x61726565, 0x6f63006f, 0x686e6570,
+  0x00616761, 0x616d6162, 0x43006f63, 0x64696d6f, 0x50207361, 0x7574726f, 0x73657567, 0x62007361,
+  0x6c616361, 0x00756168, 0x697a6f63, 0x66006f64, 0x6f6a6965, 0x00616461, 0x646c6163, 0x6576206f,
+  0x00656472, 0x6f727261, 0x6564207a, 0x74617020, 0x7274006f, 0x73617069, 0x20a0c320, 0x61646f6d,
+  0x206f6420, 0x74726f70, 0x7274006f, 0x73617069, 0x6d206120, 0x2061646f, 0x70206f64, 0x6f74726f,
+  0x61726600, 0x7365636e, 0x61686e69, 0x72617300, 0x686e6964, 0x70007361, 0x65747361, 0x6564206c,
+  0x74616e20, 0x656c0061, 0xa3c37469, 0x656c006f, 0x6f617469, 0x626f6400, 0x61646172, 0x686c6100,
+  0x61726965, 0x72654600, 0x656d6172, 0x7361746e, 0x72616d00, 0x6f6c6574, 0x61686300, 0x64206576,
+  0x65662065, 0x7361646e, 0x72657300, 0x65746f72, 0x696c6100, 0x65746163, 0x72756600, 0x69656461,
+  0x70006172, 0x66617261, 0x006f7375, 0x6d726f66, 0x006fa3c3, 0x6d726f66, 0x6c006f61, 0x00616d69,
+  0x6e657274, 0x6f740061, 0x006f6e72, 0x76616c61, 0x61636e61, 0x6d736500, 0x6c697265, 0x6e694c00,
+  0x67617567, 0x20736e65, 0x50206564, 0x72676f72, 0xc3616d61, 0x6fa3c3a7, 0x6a006300, 0x00617661,
+  0x68747970, 0x68006e6f, 0x656b7361, 0x6a006c6c, 0x73617661, 0x70697263, 0x79740074, 0x63736570,
+  0x74706972, 0x73757200, 0x6f670074, 0x69777300, 0x6b007466, 0x696c746f, 0x6373006e, 0x00616c61,
+  0x6c726570, 0x73654400, 0x74726f70, 0x6600736f, 0x62657475, 0x62006c6f, 0x75717361, 0x62657465,
+  0x61006c6f, 0x6265646e, 0x76006c6f, 0x69656c6f, 0x006c6f62, 0x62677572, 0xc3740079, 0x73696ea9,
+  0x6e657400, 0x67007369, 0x65666c6f, 0x786f6200, 0x616e0065, 0xa7c36174, 0x006fa3c3, 0x6174616e,
+  0x006f6163, 0x72677365, 0x00616d69, 0xc36e6967, 0x697473a1, 0x67006163, 0x73616e69, 0x61636974,
+  0x72616b00, 0xa9c37461, 0x72616b00, 0x00657461, 0x6165634f, 0x20736f6e, 0x614d2065, 0x00736572,
+  0xc36c7461, 0x69746ea2, 0x61006f63, 0x6e616c74, 0x6f636974, 0x63617000, 0x6966adc3, 0x70006f63,
+  0x66696361, 0x006f6369, 0x646eadc3, 0x006f6369, 0x69646e69, 0xc3006f63, 0x697472a1, 0x61006f63,
+  0x63697472, 0x6e61006f, 0x72a1c374, 0x6f636974, 0x746e6100, 0x69747261, 0x6d006f63, 0x74696465,
+  0xc3727265, 0x6f656ea2, 0x64656d00, 0x72657469, 0x656e6172, 0x616d006f, 0x6f6d2072, 0x006f7472,
+  0x2072616d, 0x6ca1c362, 0x6f636974, 0x72616d00, 0x6c616220, 0x6f636974, 0x72616d00, 0x206f6420,
+  0x74726f6e, 0x616d0065, 0x65762072, 0x6c656d72, 0x6d006f68, 0x64207261, 0x6f632065, 0x006c6172,
+  0x2072616d, 0x20736164, 0x61726163, 0x6162adc3, 0x616d0073, 0x61642072, 0x61632073, 0x62696172,
+  0x43007361, 0x6f70726f, 0x75482073, 0x6f6e616d, 0x6f630073, 0xa7c36172, 0x006fa3c3, 0x61726f63,
+  0x006f6163, 0x72a9c363, 0x6f726265, 0x72656300, 0x6f726265, 0x6c757000, 0x65b5c36d, 0x75700073,
+  0x656f6d6c, 0x73650073, 0x6db4c374, 0x006f6761, 0x6f747365, 0x6f67616d, 0xadc36600, 0x6f646167,
+  0x67696600, 0x006f6461, 0x736e6972, 0x746e6900, 0x69747365, 0x62006f6e, 0x6fa7c361, 0x63616200,
+  0xc370006f, 0x72636ea2, 0x00736165, 0x636e6170, 0x73616572, 0xc3736500, 0x676166b4, 0x7365006f,
+  0x6761666f, 0x7274006f, 0x65757161, 0x74006169, 0xc3646e65, 0x007365b5, 0x646e6574, 0x0073656f,
+  0x6e636554, 0x676f6c6f, 0x00736169, 0x72616d73, 0x6f687074, 0x6300656e, 0x75706d6f, 0x6f646174,
+  0x61740072, 0x74656c62, 0x6c657400, 0xb3c36d65, 0x006c6576, 0x656c6574, 0x65766f6d, 0x6e69006c,
+  0x6e726574, 0x77007465, 0x69662d69, 0x756c6200, 0x6f6f7465, 0x73006874, 0xa9c37461, 0x6574696c,
+  0x74617300, 0x74696c65, 0x72640065, 0x73656e6f, 0x61657200, 0x6164696c, 0x76206564, 0x75747269,
+  0x69006c61, 0x6c65746e, 0xaac36769, 0x6169636e, 0x74726120, 0x63696669, 0x006c6169, 0x65746e69,
+  0x6567696c, 0x6169636e, 0x74726120, 0x63696669, 0x006c6169, 0x6576756e, 0x6552006d, 0x736f6e69,
+  0x696e4120, 0x7369616d, 0x6d616d00, 0x6566adc3, 0x00736f72, 0x696d616d, 0x6f726566, 0xc3720073,
+  0x657470a9, 0x72007369, 0x65747065, 0x61007369, 0xadc3666e, 0x736f6962, 0x666e6100, 0x6f696269,
+  0x65700073, 0x73657869, 0x65766100, 0x6e690073, 0x6f746573, 0x72610073, 0xc36e6361, 0x6f6564ad,
+  0x72610073, 0x696e6361, 0x736f6564, 0x6c6f6d00, 0x6f637375, 0x72630073, 0xc3747375, 0x6f6563a1,
+  0x72630073, 0x61747375, 0x736f6563, 0x696e6300, 0x72a1c364, 0x00736f69, 0x64696e63, 0x6f697261,
+  0x6e610073, 0xadc36c65, 0x736f6564, 0x656e6100, 0x6564696c, 0x6500736f, 0x6e697571, 0x7265646f,
+  0x00736f6d, 0x74736546, 0x64697669, 0x73656461, 0x74616e00, 0x70006c61, 0x6373a1c3, 0x7000616f,
+  0x6f637361, 0x6e610061, 0x6f6e206f, 0x63006f76, 0x616e7261, 0x006c6176, 0x6c6c6168, 0x6565776f,
+  0x6964006e, 0x6f642061, 0x616e2073, 0x61726f6d, 0x00736f64, 0x20616964, 0x74206f64, 0x61626172,
+  0x6461686c, 0x6400726f, 0x64206169, 0x72632061, 0xc36e6169, 0x640061a7, 0x64206169, 0x72632061,
+  0x636e6169, 0x69640061, 0x61642061, 0xa3c36d20, 0x69640065, 0x61642061, 0x65616d20, 0x61696400,
+  0x206f6420, 0x00696170, 0x6fa3c373, 0xc36f6a20, 0x73006fa3, 0x6a206f61, 0x006f616f, 0x6fa3c373,
+  0x72616d20, 0x686e6974, 0x6173006f, 0x616d206f, 0x6e697472, 0x4d006f68, 0x6d756e6f, 0x6f746e65,
+  0x754d2073, 0x6169646e, 0x63007369, 0x73696c6f, 0x6d007565, 0x6c617275, 0x64206168, 0x68632061,
+  0x00616e69, 0x73697263, 0x72206f74, 0x6e656465, 0x00726f74, 0x6863616d, 0x69702075, 0x75686363,
+  0x726f7400, 0x65206572, 0x65666669, 0x6962006c, 0x65622067, 0x6174006e, 0x616d206a, 0x006c6168,
+  0xc3726970, 0x64696da2, 0x64207365, 0x6765206f, 0x006f7469, 0x61726970, 0x6564696d, 0x6f642073,
+  0x69676520, 0x65006f74, 0xa1c37473, 0x20617574, 0x6c206164, 0x72656269, 0x65646164, 0x74736500,
+  0x61757461, 0x20616420, 0x6562696c, 0x64616472, 0x74730065, 0x68656e6f, 0x65676e65, 0x74657000,
+  0x74006172, 0x6572726f, 0x20656420, 0x61736970, 0x72654600, 0x656d6172, 0x7361746e, 0x20656420,
+  0x697a6f43, 0x0061686e, 0x61636166, 0x72616700, 0x63006f66, 0x65686c6f, 0x61740072, 0x006f6863,
+  0x67697266, 0x69656469, 0x65006172, 0x726f6373, 0x6f646572, 0x61620072, 0x65646574, 0x00617269,
+  0x616c6172, 0x00726f64, 0x636e6f63, 0x65006168, 0xa1c37073, 0x616c7574, 0x70736500, 0x6c757461,
+  0x65640061, 0x73616373, 0x6f646163, 0x62610072, 0x6c2d6572, 0x73617461, 0x72655600, 0x20736f62,
+  0x50206d65, 0x7574726f, 0xaac37567, 0x65730073, 0x73650072, 0x00726174, 0x00726574, 0x66007269,
+  0x72657a61, 0x7a696400, 0x70007265, 0x7265646f, 0x72657600, 0x72616400, 0x62617300, 0x71007265,
+  0x65726575, 0x68630072, 0x72616765, 0x00000000,
+};
+
+const size_t dictionary_data_size = 8816;
@@ -38,7 +38,8 @@ void game_init(jogo_t *game) {
   game->pontuacao = 0;
   game->state = GAME_STATE_ENTER_INITIALS;
   game->countdown = 3;
-  game->timer_counter = 0;
+  game->phase_start_ns = hrclock_now_ns();
+  game->cursor_visible = true;
   
   /* Initialize letter rain game */
   memset(&game->letter_rain_game, 0, sizeof(letter_rain_t));
@@ -81,27 +82,31 @@ bool game_validate_initials(jogo_t *game) {
 void game_start_countdown(jogo_t *game) {
   game->state = GAME_STATE_COUNTDOWN;
   game->countdown = 3;
-  game->timer_counter = 0;
+  game->phase_start_ns = hrclock_now_ns();
+  game->start_pending = false;
 }
 
 bool game_update_countdown(jogo_t *game) {
-  /* Increment timer counter */
-  game->timer_counter++;
+  uint64_t steps = hrclock_elapsed_ns(game->phase_start_ns) / COUNTDOWN_STEP_NS;
   
-  /* Timer runs at 60Hz, so 60 interrupts = 1 second */
-  if (game->timer_counter >= 60) {
-    game->timer_counter = 0;
-    
-    if (game->countdown > 0) {
-      game->countdown--;
-      return false; /* Still counting down, number changed */
-    } else {
-      /* countdown reached 0, GO phase finished */
-      return true; /* Countdown finished, ready to move to letter rain */
-    }
+  /* 3, 2, 1 and then GO (countdown 0) for one more step */
+  if (steps > 3) {
+    return true; /* Countdown finished, ready to move to letter rain */
+  }
+  
+  game->countdown = 3 - (uint8_t)steps;
+  return false; /* Countdown still running, caller redraws if the number changed */
+}
+
+bool game_update_initials_cursor(jogo_t *game) {
+  bool visible = (hrclock_elapsed_ns(game->phase_start_ns) / CURSOR_BLINK_NS) % 2 == 0;
+  
+  if (visible != game->cursor_visible) {
+    game->cursor_visible = visible;
+    return true;
   }
   
-  return false; /* Countdown still running, no change */
+  return false;
 }
 
 int draw_enter_initials_page(uint16_t mouse_x, uint16_t mouse_y) {
@@ -123,7 +128,6 @@ int draw_enter_initials_page(uint16_t mouse_x, uint16_t mouse_y) {
   uint16_t field_width, field_height, field_x, field_y;
   jogo_t *game;
   uint16_t text_x, text_y;
-  static uint32_t cursor_counter = 0;
   uint16_t cursor_x;
   uint16_t button_width, button_height, button_x, button_y;
   bool button_hovered, button_enabled;
@@ -190,9 +194,8 @@ int draw_enter_initials_page(uint16_t mouse_x, uint16_t mouse_y) {
     if (draw_string_scaled(text_x, text_y, game->nome, text_white, 3) != 0) return 1;
   }
   
-  /* Draw cursor (blinking effect) */
-  cursor_counter++;
-  if ((cursor_counter / 30) % 2 == 0) { /* Blink every 30 frames */
+  /* Draw cursor (blinking effect driven by game_update_initials_cursor) */
+  if (game->cursor_visible) {
     cursor_x = text_x + strlen(game->nome) * 8 * 3;
     if (draw_string_scaled(cursor_x, text_y, "_", yellow, 3) != 0) return 1;
   }
@@ -313,6 +316,12 @@ int draw_countdown_page() {
     countdown_y = line_y + 100;
     
     if (draw_string_scaled(countdown_x, countdown_y, countdown_str, red, countdown_scale) != 0) return 1;
+    
+    if (game->start_pending) {
+      const char *wait_text = "A aguardar o outro jogador...";
+      uint16_t wait_x = (get_h_res() - strlen(wait_text) * 8 * 2) / 2;
+      if (draw_string_scaled(wait_x, countdown_y + countdown_scale * 8 + 30, wait_text, 0xffffff, 2) != 0) return 1;
+    }
   } else {
     /* Show "GO!" when countdown reaches 0 */
     go_text = "GO!";
@@ -324,6 +333,14 @@ int draw_countdown_page() {
     if (draw_string_scaled(go_x, go_y, go_text, 0x00ff00, go_scale) != 0) return 1; /* Green for GO */
   }
   
+  /* Hard mode toggle (single player only) */
+  if (!is_in_multiplayer_mode()) {
+    const char *mode_text = game->storm_mode ? "Modo tempestade: LIGADO (T para desligar)"
+                                             : "Modo tempestade: DESLIGADO (T para ligar)";
+    uint16_t mode_x = (get_h_res() - strlen(mode_text) * 8) / 2;
+    if (draw_string_scaled(mode_x, get_v_res() - 80, mode_text, game->storm_mode ? red : 0xffffff, 1) != 0) return 1;
+  }
+  
   /* Add some decorative elements */
   corner_size = 30;
   
@@ -409,8 +426,9 @@ int game_start_letter_rain(jogo_t *game) {
   /* Limpa o estado anterior do letter rain game */
   memset(&game->letter_rain_game, 0, sizeof(letter_rain_t));
   
-  /* Initialize the letter rain mini-game */
-  int init_result = letter_rain_init(&game->letter_rain_game);
+  /* Initialize the letter rain mini-game. 2 player games always use the normal rain:
+   * both players must draw the same letter sequence from the shared seed */
+  int init_result = letter_rain_init(&game->letter_rain_game, game->storm_mode && !is_in_multiplayer_mode());
   
   if (init_result != 0) {
     printf("game_start_letter_rain: letter_rain_init failed with code %d\n", init_result);
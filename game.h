@@ -4,10 +4,15 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "letter_rain.h"
+#include "hrclock.h"
 
 /* Maximum length for player initials */
 #define MAX_INITIALS 4
 
+/* Real-time durations of the pre-game phases */
+#define COUNTDOWN_STEP_NS NS_PER_SEC          /* Each of 3, 2, 1 and GO is shown for a second */
+#define CURSOR_BLINK_NS (500 * NS_PER_MS)     /* Cursor toggles every half second */
+
 /* Game states for single player mode */
 typedef enum {
   GAME_STATE_ENTER_INITIALS,
@@ -24,7 +29,10 @@ typedef struct {
   int pontuacao;              /* Current score */
   single_player_state_t state; /* Current game state */
   uint8_t countdown;          /* Countdown timer (3, 2, 1) */
-  uint32_t timer_counter;     /* Timer counter for countdown */
+  uint64_t phase_start_ns;    /* Clock time the current phase started (countdown and cursor blinking) */
+  bool start_pending;         /* 2 player mode: the countdown waits for the shared start time */
+  bool cursor_visible;        /* Blinking cursor state on the initials page */
+  bool storm_mode;            /* Hard mode: letter storm instead of the normal letter rain */
   letter_rain_t letter_rain_game; /* Letter rain mini-game */
 } jogo_t;
 
@@ -81,6 +89,14 @@ void game_start_countdown(jogo_t *game);
  */
 bool game_update_countdown(jogo_t *game);
 
+/**
+ * @brief Update the blinking cursor of the initials page
+ * 
+ * @param game Pointer to game structure
+ * @return True if the cursor toggled (page must be redrawn)
+ */
+bool game_update_initials_cursor(jogo_t *game);
+
 /**
  * @brief Draw the enter initials page
  * 
@@ -3,7 +3,6 @@
 #include <ctype.h>
 #include <stdlib.h>
 #include "gameLogic.h"
-#include "dicionarios.h"
 
 int TestMode = 0;
 
@@ -57,7 +56,9 @@ int distanciaLevenshtein(const char* s1, const char* s2) {
     return dp[len1][len2];
 }
 
-int verificarEntrada(Categoria* categoria, char respondidas[][MAX_ENTRADA], int* respondidasCount, const char* entradaOriginal) {
+/* Index of the closest category word within distance 1 of the input (lowest index on ties), -1 if none.
+ * Excluded words still count as closest: if they are, only another word just as close may be returned */
+int procurarPalavra(const dict_category_t* categoria, const char* entradaOriginal, const conjunto_palavras_t* excluir) {
     char entrada[MAX_ENTRADA];
     strncpy(entrada, entradaOriginal, MAX_ENTRADA);
     entrada[MAX_ENTRADA-1] = '\0'; 
@@ -65,36 +66,62 @@ int verificarEntrada(Categoria* categoria, char respondidas[][MAX_ENTRADA], int*
     for (int i = 0; entrada[i]; i++)
         entrada[i] = tolower((unsigned char)entrada[i]);
     removerAcentos(entrada);
+    int len = strlen(entrada);
+
+    /* Dictionary keys are already normalized */
+    int melhorDistancia = 2;
+    int melhor = -1;
+    for (int i = 0; i < (int)categoria->word_count; i++) {
+        const dict_word_t* palavra = dictionary_word(categoria, i);
+        if (abs(palavra->key_len - len) > 1) continue;
+
+        int distancia = distanciaLevenshtein(entrada, dictionary_string(palavra->key));
+        if (distancia > 1) continue;
+        bool excluida = excluir != NULL && conjuntoContem(excluir, i);
+        if (distancia < melhorDistancia) {
+            /* A closer word, even an excluded one, rules out the words found so far */
+            melhorDistancia = distancia;
+            melhor = excluida ? -1 : i;
+        } else if (distancia == melhorDistancia && melhor < 0 && !excluida) {
+            melhor = i;
+        }
+    }
 
-    for (int i = 0; i < *respondidasCount; i++) {
-        char comparada[MAX_ENTRADA];
-        strncpy(comparada, respondidas[i], MAX_ENTRADA);
-        comparada[MAX_ENTRADA-1] = '\0';
-
-        for (int j = 0; comparada[j]; j++)
-            comparada[j] = tolower((unsigned char)comparada[j]);
-        removerAcentos(comparada);
+    return melhor;
+}
 
-        if (strcmp(comparada, entrada) == 0)
-            return -1; 
-    }
+/* Number of words in a word set */
+int contarPalavras(const conjunto_palavras_t* conjunto) {
+    int total = 0;
+    for (int i = 0; i < CONJUNTO_BLOCOS; i++)
+        total += __builtin_popcount(conjunto->blocos[i]);
+    return total;
+}
 
-    for (int i = 0; i < categoria->totalPontuacoes; i++) {
-        char correta[MAX_ENTRADA];
-        strncpy(correta, categoria->pontuacoes[i].palavra, MAX_ENTRADA);
-        correta[MAX_ENTRADA-1] = '\0';
+bool conjuntoContem(const conjunto_palavras_t* conjunto, int palavra) {
+    return (conjunto->blocos[palavra >> 5] >> (palavra & 31)) & 1;
+}
 
-        for (int j = 0; correta[j]; j++)
-            correta[j] = tolower((unsigned char)correta[j]);
-        removerAcentos(correta);
+void conjuntoAdicionar(conjunto_palavras_t* conjunto, int palavra) {
+    conjunto->blocos[palavra >> 5] |= (uint32_t)1 << (palavra & 31);
+}
 
-        if (distanciaLevenshtein(entrada, correta) <= 1) {
-            strncpy(respondidas[*respondidasCount], categoria->pontuacoes[i].palavra, MAX_ENTRADA);
-            respondidas[*respondidasCount][MAX_ENTRADA-1] = '\0';
-            (*respondidasCount)++;
-            return categoria->pontuacoes[i].pontuacao;
-        }
-    }
+/* Bit of a letter in a letter mask (bit 0 = 'a'), 0 if it is not a letter */
+uint32_t bitLetra(char letra) {
+    int c = tolower((unsigned char)letra);
+    if (c < 'a' || c > 'z') return 0;
+    return (uint32_t)1 << (c - 'a');
+}
 
-    return 0; 
+/* Letters present in a word after lowercasing and removing accents */
+uint32_t mascaraLetras(const char* palavra) {
+    char normalizada[MAX_ENTRADA];
+    strncpy(normalizada, palavra, MAX_ENTRADA);
+    normalizada[MAX_ENTRADA-1] = '\0';
+    removerAcentos(normalizada);
+
+    uint32_t mascara = 0;
+    for (int i = 0; normalizada[i]; i++)
+        mascara |= bitLetra(normalizada[i]);
+    return mascara;
 }
@@ -4,11 +4,24 @@
 #define MAX_RESPONDIDAS 100
 #define MAX_ENTRADA 100
 
-#include "dicionarios.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "dictionary.h"
+
+/* Set of words of a category, bit i refers to word i */
+#define CONJUNTO_BLOCOS (DICT_MAX_CATEGORY_WORDS / 32)
+typedef struct {
+    uint32_t blocos[CONJUNTO_BLOCOS];
+} conjunto_palavras_t;
 
 extern int TestMode;
 
-int verificarEntrada(Categoria* categoria, char respondidas[][MAX_ENTRADA], int* respondidasCount, const char* entrada);
+int procurarPalavra(const dict_category_t* categoria, const char* entrada, const conjunto_palavras_t* excluir);
+int contarPalavras(const conjunto_palavras_t* conjunto);
+bool conjuntoContem(const conjunto_palavras_t* conjunto, int palavra);
+void conjuntoAdicionar(conjunto_palavras_t* conjunto, int palavra);
+uint32_t mascaraLetras(const char* palavra);
+uint32_t bitLetra(char letra);
 int distanciaLevenshtein(const char* s1, const char* s2);
 void removerAcentos(char* str);
 
@@ -0,0 +1,61 @@
+#ifndef _HRCLOCK_H_
+#define _HRCLOCK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NS_PER_SEC 1000000000ULL /* Nanoseconds in a second */
+#define NS_PER_MS  1000000ULL    /* Nanoseconds in a millisecond */
+
+/**
+ * @brief Calibrate the CPU timestamp counter against i8254 timer 2
+ *
+ * Must be called once at startup. If the calibration fails the clock falls
+ * back to counting timer interrupts (see hrclock_tick).
+ *
+ * @return 0 on success, 1 if the timestamp counter could not be calibrated
+ */
+int hrclock_init();
+
+/**
+ * @brief Get a monotonic timestamp
+ *
+ * @return Nanoseconds since hrclock_init
+ */
+uint64_t hrclock_now_ns();
+
+/**
+ * @brief Get the nanoseconds elapsed since an earlier timestamp
+ *
+ * @param since Timestamp returned by hrclock_now_ns
+ * @return Nanoseconds elapsed (0 if since is in the future)
+ */
+uint64_t hrclock_elapsed_ns(uint64_t since);
+
+/**
+ * @brief Check if the timestamp counter is being used
+ *
+ * @return True if calibrated, false if running on timer interrupts
+ */
+bool hrclock_calibrated();
+
+/**
+ * @brief Get the calibrated timestamp counter frequency
+ *
+ * @return Timestamp counter ticks per second, 0 if not calibrated
+ */
+uint64_t hrclock_tsc_hz();
+
+/**
+ * @brief Advance the fallback clock by one timer period (call on every timer interrupt)
+ */
+void hrclock_tick();
+
+/**
+ * @brief Tell the fallback clock the current timer 0 frequency
+ *
+ * @param hz Timer interrupts per second
+ */
+void hrclock_set_tick_rate(uint32_t hz);
+
+#endif /* _HRCLOCK_H_ */
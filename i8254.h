@@ -21,6 +21,12 @@
 
 #define SPEAKER_CTRL 0x61 /**< @brief Register for speaker control  */
 
+/* Speaker control register bits */
+
+#define SPEAKER_GATE2 BIT(0) /**< @brief Timer 2 gate input */
+#define SPEAKER_DATA  BIT(1) /**< @brief Connect timer 2 output to the speaker */
+#define SPEAKER_OUT2  BIT(5) /**< @brief Timer 2 output (read only) */
+
 /* Timer control */
 
 /* Timer selection: bits 7 and 6 */
@@ -40,6 +46,7 @@
 
 #define TIMER_SQR_WAVE (BIT(2) | BIT(1)) /**< @brief Mode 3: square wave generator */
 #define TIMER_RATE_GEN BIT(2)            /**< @brief Mode 2: rate generator */
+#define TIMER_INT_TC   0x00              /**< @brief Mode 0: interrupt on terminal count */
 
 /* Counting mode: bit 0 */
 
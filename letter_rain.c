@@ -1,5 +1,4 @@
 #include "letter_rain.h"
-#include "sprite.h"
 #include "videocard.h"
 #include "font.h"
 #include <stdlib.h>
@@ -9,69 +8,29 @@
 #define A_MAKE 0x1E
 #define D_MAKE 0x20
 
-/* Variável estática para seed do random */
-static uint32_t rand_seed = 1;
-
-/* Função simples de random (Linear Congruential Generator) */
-static uint32_t simple_rand() {
-    static uint32_t call_count = 0;
-    call_count++;
-
-    rand_seed = rand_seed * 1103515245 + 12345 + call_count;
-
-    return (rand_seed / 65536) % 32768;
-}
-
-/* Inicializa o seed do random */
-static void simple_srand(uint32_t seed) {
-    rand_seed = seed;
-}
-
-/* Tabela de probabilidades acumuladas para letras portuguesas (x100 para evitar decimais) */
-static const int letter_probabilities[] = {
-    1463,  /* A: 14.63% */
-    1567,  /* B: 1.04% (1463 + 104) */
-    1955,  /* C: 3.88% (1567 + 388) */
-    2454,  /* D: 4.99% (1955 + 499) */
-    3711,  /* E: 12.57% (2454 + 1257) */
-    3813,  /* F: 1.02% (3711 + 102) */
-    3943,  /* G: 1.30% (3813 + 130) */
-    4071,  /* H: 1.28% (3943 + 128) */
-    4689,  /* I: 6.18% (4071 + 618) */
-    4729,  /* J: 0.40% (4689 + 40) */
-    4731,  /* K: 0.02% (4729 + 2) */
-    5009,  /* L: 2.78% (4731 + 278) */
-    5483,  /* M: 4.74% (5009 + 474) */
-    5988,  /* N: 5.05% (5483 + 505) */
-    7061,  /* O: 10.73% (5988 + 1073) */
-    7313,  /* P: 2.52% (7061 + 252) */
-    7433,  /* Q: 1.20% (7313 + 120) */
-    8086,  /* R: 6.53% (7433 + 653) */
-    8867,  /* S: 7.81% (8086 + 781) */
-    9301,  /* T: 4.34% (8867 + 434) */
-    9764,  /* U: 4.63% (9301 + 463) */
-    9931,  /* V: 1.67% (9764 + 167) */
-    9932,  /* W: 0.01% (9931 + 1) */
-    9953,  /* X: 0.21% (9932 + 21) */
-    9954,  /* Y: 0.01% (9953 + 1) */
-    10000  /* Z: 0.47% (9954 + 46) - Total: 100.00% */
+/* Pesos das letras portuguesas (letter_probability_t), amostrados por tabela de alias */
+static const uint32_t letter_weights[26] = {
+    PROB_A, PROB_B, PROB_C, PROB_D, PROB_E, PROB_F, PROB_G, PROB_H, PROB_I,
+    PROB_J, PROB_K, PROB_L, PROB_M, PROB_N, PROB_O, PROB_P, PROB_Q, PROB_R,
+    PROB_S, PROB_T, PROB_U, PROB_V, PROB_W, PROB_X, PROB_Y, PROB_Z
 };
 
-char get_random_letter() {
-    /* Gerar número aleatório entre 0 e 9999 (equivale a 0.00% a 99.99%) */
-    int random_value = simple_rand() % 10000;
-    
-    /* Encontrar a letra correspondente usando as probabilidades acumuladas */
-    for (int i = 0; i < 26; i++) {
-        if (random_value < letter_probabilities[i]) {
-            return 'A' + i;  /* Retorna a letra correspondente */
-        }
+static alias_table_t letter_table;
+static bool letter_table_built = false;
+
+char get_random_letter(rng_t *rng) {
+    if (!letter_table_built) {
+        alias_build(&letter_table, letter_weights, 26);
+        letter_table_built = true;
     }
     
-    /* Fallback para 'Z' (não deve acontecer) */
-    return 'Z';
+    /* Constant time, whatever the number of letters */
+    return 'A' + alias_sample(&letter_table, rng);
 }
 
+/* Four int32 lanes; the compiler emits SSE2 (or scalar code) for the target */
+typedef int32_t lanes_t __attribute__((vector_size(LETTER_LANES * sizeof(int32_t))));
+
 /* Função para apagar um sprite específico */
 static void erase_letter_sprite(int x, int y, int width, int height) {
     if (draw_filled_rectangle(x, y, width, height, 0x1a1a2e) != 0) {
@@ -79,63 +38,113 @@ static void erase_letter_sprite(int x, int y, int width, int height) {
     }
 }
 
-/* Função simplificada para criar sprite de letra */
-Sprite *create_letter_sprite(char letter, int x, int y) {
-    Sprite *sp = (Sprite *) malloc(sizeof(Sprite));
-    if (sp == NULL) {
-        return NULL;
+/* Mark the row bands covered by an erased rectangle, letters there must be redrawn */
+static void mark_dirty_rows(letter_rain_t *game, int y, int height) {
+    int first = y < 0 ? 0 : y >> DIRTY_BAND_SHIFT;
+    int last = (y + height - 1) >> DIRTY_BAND_SHIFT;
+    if (last > 63) last = 63;
+    for (int band = first; band <= last; band++) game->dirty_bands |= (uint64_t)1 << band;
+}
+
+static bool rows_dirty(const letter_rain_t *game, int y, int height) {
+    int first = y < 0 ? 0 : y >> DIRTY_BAND_SHIFT;
+    int last = (y + height - 1) >> DIRTY_BAND_SHIFT;
+    if (last < 0) return false;
+    if (last > 63) last = 63;
+    uint64_t bands = (last >= 63 ? ~(uint64_t)0 : ((uint64_t)1 << (last + 1)) - 1) & ~(((uint64_t)1 << first) - 1);
+    return (game->dirty_bands & bands) != 0;
+}
+
+/* Mark the panel rows a rectangle drawn or erased by the rain went over */
+static void panel_touch(letter_rain_t *game, int x, int y, int width, int height) {
+    if (x >= PANEL_X + PANEL_WIDTH || x + width <= PANEL_X) return;
+    
+    if (y < PANEL_TITLE_Y + PANEL_ROW_HEIGHT && y + height > PANEL_TITLE_Y) game->panel_dirty |= PANEL_TITLE_BIT;
+    
+    int first = (y - PANEL_ROWS_Y) / PANEL_ROW_HEIGHT;
+    int last = (y + height - 1 - PANEL_ROWS_Y) / PANEL_ROW_HEIGHT;
+    if (y + height <= PANEL_ROWS_Y) return;
+    if (first < 0) first = 0;
+    if (last >= game->panel_rows) last = game->panel_rows - 1;
+    for (int row = first; row <= last; row++) game->panel_dirty |= 1u << row;
+}
+
+/* Catch event: the letter's panel row (added on its first catch) must be redrawn */
+static void panel_catch(letter_rain_t *game, int letter_index) {
+    if (game->panel_row[letter_index] < 0) {
+        game->panel_row[letter_index] = (int8_t)game->panel_rows;
+        game->panel_letter[game->panel_rows++] = (char)('A' + letter_index);
+    }
+    game->panel_dirty |= 1u << game->panel_row[letter_index];
+    request_page_redraw();
+}
+
+/* Erase what a letter covered at its last position and no longer covers at y.
+ * Moving less than its size uncovers just a strip, the new draw covers the rest */
+static void erase_letter_trail(letter_rain_t *game, int i, int y) {
+    letter_pool_t *pool = &game->letters;
+    int last_x = pool->last_x[i], last_y = pool->last_y[i];
+    int top = last_y, height = LETTER_SIZE;
+    
+    if (last_x == pool->x[i] && y > last_y && y - last_y < LETTER_SIZE) {
+        height = y - last_y;                     /* Moved down: strip above the letter */
+    } else if (last_x == pool->x[i] && y < last_y && last_y - y < LETTER_SIZE) {
+        top = y + LETTER_SIZE;                   /* Moved up: strip below it */
+        height = last_y - y;
     }
     
-    sp->width = 16;
-    sp->height = 16;
-    sp->x = x;
-    sp->y = y;
-    sp->xspeed = 0;
-    sp->yspeed = LETTER_FALL_SPEED;
-    sp->map = NULL; // Não precisamos de mapa para desenho simples
-    
-    return sp;
+    erase_letter_sprite(last_x, top, LETTER_SIZE, height);
+    mark_dirty_rows(game, top, height);
+    panel_touch(game, last_x, top, LETTER_SIZE, height);
 }
 
-/* Função simplificada para criar sprite do board */
-Sprite *create_board_sprite(int x, int y) {
-    Sprite *sp = (Sprite *) malloc(sizeof(Sprite));
-    if (sp == NULL) {
-        return NULL;
+/* Take letter i out of play, erasing it where it was last drawn and where it is now.
+ * The last letter moves into slot i */
+static void release_letter(letter_rain_t *game, int i) {
+    letter_pool_t *pool = &game->letters;
+    if (pool->last_x[i] >= 0 && pool->last_y[i] >= 0) {
+        erase_letter_sprite(pool->last_x[i], pool->last_y[i], LETTER_SIZE, LETTER_SIZE);
+        mark_dirty_rows(game, pool->last_y[i], LETTER_SIZE);
+        panel_touch(game, pool->last_x[i], pool->last_y[i], LETTER_SIZE, LETTER_SIZE);
     }
-    
-    sp->width = BOARD_WIDTH;
-    sp->height = BOARD_HEIGHT;
-    sp->x = x;
-    sp->y = y;
-    sp->xspeed = 0;
-    sp->yspeed = 0;
-    sp->map = NULL; // Não precisamos de mapa para desenho simples
-    
-    return sp;
+    erase_letter_sprite(pool->x[i], FP_TO_INT(pool->y_fp[i]), LETTER_SIZE, LETTER_SIZE);
+    mark_dirty_rows(game, FP_TO_INT(pool->y_fp[i]), LETTER_SIZE);
+    panel_touch(game, pool->x[i], FP_TO_INT(pool->y_fp[i]), LETTER_SIZE, LETTER_SIZE);
+    
+    int last = --pool->count;
+    pool->y_fp[i] = pool->y_fp[last];
+    pool->prev_y_fp[i] = pool->prev_y_fp[last];
+    pool->vy_fp[i] = pool->vy_fp[last];
+    pool->x[i] = pool->x[last];
+    pool->last_x[i] = pool->last_x[last];
+    pool->last_y[i] = pool->last_y[last];
+    pool->glyph[i] = pool->glyph[last];
+    pool->color[i] = pool->color[last];
+    pool->vy_fp[last] = 0; /* Padding lanes of the vector loops stay still */
 }
 
-int letter_rain_init(letter_rain_t *game) {
+int letter_rain_init(letter_rain_t *game, bool storm) {
     if (game == NULL)
         return 1;
     
-    // Initialize random seed com valor baseado em endereço (pseudo-random)
-    simple_srand((uint32_t)game);
-    
-    // Initialize all letters as inactive
-    for (int i = 0; i < MAX_FALLING_LETTERS; i++) {
-        game->letters[i].active = false;
-        game->letters[i].sprite = NULL;
-        game->letters[i].letter = 'A';
-        game->letters[i].color = 0xFFFFFF;
-        game->letters[i].last_x = -1; /* Initialize previous positions */
-        game->letters[i].last_y = -1;
-    }
+    // Streams derived from the game seed, so a round can be replayed
+    rng_stream(&game->letter_rng, RNG_STREAM_LETTERS);
+    rng_stream(&game->spawn_rng, RNG_STREAM_SPAWN_X);
+    
+    // All letters live in the fixed pool: nothing is allocated while playing
+    memset(&game->letters, 0, sizeof(game->letters));
+    game->storm = storm;
+    game->max_letters = storm ? LETTER_POOL_SIZE : MAX_FALLING_LETTERS;
+    game->catches_to_win = storm ? LETTER_STORM_CATCHES : CATCHES_TO_WIN;
+    game->dirty_bands = 0;
     
     // Initialize letter collection counters (A=0, B=1, ..., Z=25)
     for (int i = 0; i < 26; i++) {
         game->letter_counters[i] = 0;
+        game->panel_row[i] = -1;
     }
+    game->panel_rows = 0;
+    game->panel_dirty = PANEL_TITLE_BIT;
     
     // Initialize board at bottom center
     uint16_t screen_width = get_h_res();
@@ -151,119 +160,117 @@ int letter_rain_init(letter_rain_t *game) {
     game->board.height = BOARD_HEIGHT;
     game->board.last_x = -1; /* Initialize previous position */
     
-    // Criar sprite do board
-    game->board.sprite = create_board_sprite(game->board.x, game->board.y);
-    if (game->board.sprite == NULL) {
-        return 1;
-    }
-    
     // Initialize game state
     game->caught_letter = 0;
     game->game_over = false;
-    game->frame_counter = 0;
-    game->spawn_rate = 35; // Spawn a letter every second (35 FPS)
+    game->last_update_ns = hrclock_now_ns();
+    game->accumulator_ns = 0;
+    game->steps_to_spawn = storm ? 1 : LETTER_SPAWN_STEPS;
+    game->alpha_fp = 0;
     game->first_draw = true; /* Flag for first draw */
     
     return 0;
 }
 
-int letter_rain_update(letter_rain_t *game) {
-    if (game == NULL || game->game_over)
-        return 1;
-    
-    game->frame_counter++;
-    
-    // Spawn new letter if it's time
-    if (game->frame_counter >= game->spawn_rate) {
-        game->frame_counter = 0;
-        
-        // Find inactive letter slot
-        for (int i = 0; i < MAX_FALLING_LETTERS; i++) {
-            if (!game->letters[i].active) {
-                game->letters[i].letter = get_random_letter();
-                game->letters[i].active = true;
-                
-                // Random X position across screen width
-                uint16_t screen_width = get_h_res();
-                if (screen_width <= 16) break;
-                
-                int x = simple_rand() % (screen_width - 30);
-                int y = -16; // Start above screen
-                
-                game->letters[i].sprite = create_letter_sprite(game->letters[i].letter, x, y);
-                if (game->letters[i].sprite == NULL) {
-                    game->letters[i].active = false;
-                } else {
-                    /* Initialize previous position to INVALID so it won't be erased */
-                    game->letters[i].last_x = -1;
-                    game->letters[i].last_y = -1;
-                }
-                break;
-            }
-        }
+/* Interpolated Y of a letter between its last two simulation steps */
+static int letter_render_y(const letter_rain_t *game, int i) {
+    int32_t prev = game->letters.prev_y_fp[i];
+    int32_t dy = game->letters.y_fp[i] - prev;
+    return FP_TO_INT(prev + (int32_t)(((int64_t)dy * game->alpha_fp) >> FP_SHIFT));
+}
+
+/* Put a new letter above the screen at a random column */
+static void spawn_letter(letter_rain_t *game) {
+    letter_pool_t *pool = &game->letters;
+    uint16_t screen_width = get_h_res();
+    if (pool->count >= game->max_letters || screen_width <= 30) return;
+    
+    int i = pool->count++;
+    pool->glyph[i] = get_random_letter(&game->letter_rng);
+    pool->color[i] = 0xFFFFFF;
+    pool->x[i] = (int16_t)rng_range(&game->spawn_rng, screen_width - 30);
+    pool->y_fp[i] = INT_TO_FP(-LETTER_SIZE);
+    pool->prev_y_fp[i] = pool->y_fp[i];
+    pool->vy_fp[i] = LETTER_FALL_STEP_FP;
+    if (game->storm) {
+        uint32_t speed = LETTER_STORM_MIN_SPEED +
+                         rng_range(&game->spawn_rng, LETTER_STORM_MAX_SPEED - LETTER_STORM_MIN_SPEED + 1);
+        pool->vy_fp[i] = (int32_t)(speed * FP_ONE / LETTER_RAIN_STEP_HZ);
+    }
+    /* Initialize previous position to INVALID so it won't be erased */
+    pool->last_x[i] = -1;
+    pool->last_y[i] = -1;
+}
+
+/* prev_y = y, y += vy for every letter, LETTER_LANES at a time */
+static void integrate_letters(letter_pool_t *pool) {
+    int n = (pool->count + LETTER_LANES - 1) & ~(LETTER_LANES - 1);
+    for (int i = 0; i < n; i += LETTER_LANES) {
+        lanes_t y, vy;
+        memcpy(&y, &pool->y_fp[i], sizeof(y));
+        memcpy(&vy, &pool->vy_fp[i], sizeof(vy));
+        memcpy(&pool->prev_y_fp[i], &y, sizeof(y));
+        y += vy;
+        memcpy(&pool->y_fp[i], &y, sizeof(y));
+    }
+}
+
+/* One fixed simulation step: spawn, fall and collide. Returns 1 when a letter was caught enough times */
+static int letter_rain_step(letter_rain_t *game) {
+    letter_pool_t *pool = &game->letters;
+    
+    // Spawn new letters if it's time
+    if (--game->steps_to_spawn == 0) {
+        game->steps_to_spawn = game->storm ? 1 : LETTER_SPAWN_STEPS;
+        for (int k = game->storm ? LETTER_STORM_SPAWN : 1; k > 0; k--) spawn_letter(game);
     }
     
     // Update falling letters
-    for (int i = 0; i < MAX_FALLING_LETTERS; i++) {
-        if (game->letters[i].active && game->letters[i].sprite != NULL) {
-            
-            // Move letter down (this updates sprite position)
-            animate_sprite(game->letters[i].sprite);
+    integrate_letters(pool);
+    
+    /* Only letters at or below the board's rows can be caught or leave the screen:
+     * one vector compare per LETTER_LANES letters finds them. Walking down from the
+     * top keeps the letter swapped in by a removal already processed */
+    int32_t band_top = INT_TO_FP(game->board.y - LETTER_SIZE + 1);
+    lanes_t top = {band_top, band_top, band_top, band_top};
+    int bottom = (int)get_v_res();
+    int n = (pool->count + LETTER_LANES - 1) & ~(LETTER_LANES - 1);
+    for (int block = n - LETTER_LANES; block >= 0; block -= LETTER_LANES) {
+        lanes_t y;
+        memcpy(&y, &pool->y_fp[block], sizeof(y));
+        lanes_t near = y >= top;
+        if ((near[0] | near[1] | near[2] | near[3]) == 0) continue;
+        
+        for (int lane = LETTER_LANES - 1; lane >= 0; lane--) {
+            int i = block + lane;
+            if (!near[lane] || i >= pool->count) continue;
             
             // Check if letter hit the board
-            if (check_letter_board_collision(&game->letters[i], &game->board)) {
-                char caught = game->letters[i].letter;
+            if (check_letter_board_collision(pool, i, &game->board)) {
+                char caught = pool->glyph[i];
                 int letter_index = caught - 'A';
                 
-                /* APAGAR o sprite da tela antes de destruir */
-                if (game->letters[i].last_x >= 0 && game->letters[i].last_y >= 0) {
-                    erase_letter_sprite(game->letters[i].last_x, game->letters[i].last_y, 16, 16);
-                }
-                erase_letter_sprite(game->letters[i].sprite->x, game->letters[i].sprite->y, 16, 16);
+                /* APAGAR a letra da tela antes de a libertar */
+                release_letter(game, i);
                 
                 // Increment counter for this letter
                 if (letter_index >= 0 && letter_index < 26) {
                     game->letter_counters[letter_index]++;
+                    panel_catch(game, letter_index);
                     
-                    // Check if we caught this letter twice
-                    if (game->letter_counters[letter_index] >= 2) {
+                    // Check if we caught this letter enough times
+                    if (game->letter_counters[letter_index] >= game->catches_to_win) {
                         game->caught_letter = caught;
                         game->game_over = true;
-                        
-                        // Cleanup this letter
-                        destroy_sprite(game->letters[i].sprite);
-                        game->letters[i].sprite = NULL;
-                        game->letters[i].active = false;
-                        game->letters[i].last_x = -1;
-                        game->letters[i].last_y = -1;
-                        
                         return 1; // Game won!
                     }
                 }
-                
-                // Cleanup this letter (caught once, continue game)
-                destroy_sprite(game->letters[i].sprite);
-                game->letters[i].sprite = NULL;
-                game->letters[i].active = false;
-                game->letters[i].last_x = -1;
-                game->letters[i].last_y = -1;
                 continue;
             }
             
             // Check if letter hit the bottom edge (missed)
-            if (game->letters[i].sprite->y >= (int)get_v_res()) {
-                /* APAGAR o sprite da tela antes de destruir */
-                if (game->letters[i].last_x >= 0 && game->letters[i].last_y >= 0) {
-                    erase_letter_sprite(game->letters[i].last_x, game->letters[i].last_y, 16, 16);
-                }
-                erase_letter_sprite(game->letters[i].sprite->x, game->letters[i].sprite->y, 16, 16);
-                
-                // Deactivate letter
-                destroy_sprite(game->letters[i].sprite);
-                game->letters[i].sprite = NULL;
-                game->letters[i].active = false;
-                game->letters[i].last_x = -1;
-                game->letters[i].last_y = -1;
+            if (FP_TO_INT(pool->y_fp[i]) >= bottom) {
+                release_letter(game, i);
             }
         }
     }
@@ -271,6 +278,38 @@ int letter_rain_update(letter_rain_t *game) {
     return 0;
 }
 
+int letter_rain_update(letter_rain_t *game) {
+    if (game == NULL || game->game_over)
+        return 1;
+    
+    uint64_t now = hrclock_now_ns();
+    game->accumulator_ns += now - game->last_update_ns;
+    game->last_update_ns = now;
+    
+    // A long stall (slow redraw, debugger) must not make the rain jump or speed up
+    if (game->accumulator_ns > LETTER_RAIN_MAX_STEPS * LETTER_RAIN_STEP_NS)
+        game->accumulator_ns = LETTER_RAIN_MAX_STEPS * LETTER_RAIN_STEP_NS;
+    
+    while (game->accumulator_ns >= LETTER_RAIN_STEP_NS) {
+        game->accumulator_ns -= LETTER_RAIN_STEP_NS;
+        if (letter_rain_step(game) != 0)
+            return 1;
+    }
+    
+    // Leftover time decides how far between the last two steps to draw
+    game->alpha_fp = (int32_t)(game->accumulator_ns * FP_ONE / LETTER_RAIN_STEP_NS);
+    
+    // Redraw only if some letter would appear somewhere else
+    for (int i = 0; i < game->letters.count; i++) {
+        if (letter_render_y(game, i) != game->letters.last_y[i]) {
+            request_page_redraw();
+            break;
+        }
+    }
+    
+    return 0;
+}
+
 int letter_rain_draw(letter_rain_t *game) {
     if (game == NULL)
         return 1;
@@ -280,42 +319,48 @@ int letter_rain_draw(letter_rain_t *game) {
         if (clear_screen(0x1a1a2e) != 0)
             return 1;
         game->first_draw = false;
+        game->panel_dirty = PANEL_TITLE_BIT | ((1u << game->panel_rows) - 1);
+    }
+    
+    /* Handle falling letters in two batches: erase every letter that moved, then draw
+     * the moved ones and any still letter whose rows an erase went over */
+    letter_pool_t *pool = &game->letters;
+    for (int i = 0; i < pool->count; i++) {
+        int y = letter_render_y(game, i);
+        if (pool->last_x[i] >= 0 && pool->last_y[i] >= 0 && y != pool->last_y[i]) {
+            erase_letter_trail(game, i, y);
+        }
     }
     
-    /* Handle falling letters */
-    for (int i = 0; i < MAX_FALLING_LETTERS; i++) {
-        if (game->letters[i].active && game->letters[i].sprite != NULL) {
+    int h_res = (int)get_h_res(), v_res = (int)get_v_res();
+    for (int i = 0; i < pool->count; i++) {
+        int x = pool->x[i];
+        int y = letter_render_y(game, i);
+        if (y == pool->last_y[i] && !rows_dirty(game, y, LETTER_SIZE)) continue;
+        
+        /* Desenhar na posição interpolada apenas se estiver dentro dos limites */
+        if (x >= -LETTER_SIZE && y >= -LETTER_SIZE && x < h_res + LETTER_SIZE && y < v_res + LETTER_SIZE) {
             
-            /* SEMPRE apagar a posição anterior se existir */
-            if (game->letters[i].last_x >= 0 && game->letters[i].last_y >= 0) {
-                erase_letter_sprite(game->letters[i].last_x, game->letters[i].last_y, 16, 16);
+            /* Draw letter background (simple rectangle) */
+            if (draw_filled_rectangle(x, y, LETTER_SIZE, LETTER_SIZE, 0x666666) != 0) {
+                return 1;
             }
             
-            /* Desenhar na nova posição apenas se estiver dentro dos limites */
-            if (game->letters[i].sprite->x >= -16 && game->letters[i].sprite->y >= -16 &&
-                game->letters[i].sprite->x < (int)get_h_res() + 16 && 
-                game->letters[i].sprite->y < (int)get_v_res() + 16) {
-                
-                /* Draw letter background (simple rectangle) */
-                if (draw_filled_rectangle(game->letters[i].sprite->x, game->letters[i].sprite->y,
-                                         16, 16, 0x666666) != 0) {
-                    return 1;
-                }
-                
-                /* Draw letter character on top */
-                char letter_str[2] = {game->letters[i].letter, '\0'};
-                int text_x = game->letters[i].sprite->x + 4;
-                int text_y = game->letters[i].sprite->y + 4;
-                
-                if (draw_string_scaled(text_x, text_y, letter_str, 0xFFFFFF, 1) != 0)
-                    return 1;
-            }
+            /* Draw letter character on top */
+            char letter_str[2] = {pool->glyph[i], '\0'};
+            int text_x = x + 4;
+            int text_y = y + 4;
             
-            /* SEMPRE atualizar a última posição */
-            game->letters[i].last_x = game->letters[i].sprite->x;
-            game->letters[i].last_y = game->letters[i].sprite->y;
+            if (draw_string_scaled(text_x, text_y, letter_str, pool->color[i], 1) != 0)
+                return 1;
+            panel_touch(game, x, y, LETTER_SIZE, LETTER_SIZE);
         }
+        
+        /* SEMPRE atualizar a última posição */
+        pool->last_x[i] = (int16_t)x;
+        pool->last_y[i] = (int16_t)y;
     }
+    game->dirty_bands = 0;
     
     /* Erase board from previous position if it moved */
     if (game->board.last_x != -1 && game->board.last_x != game->board.x) {
@@ -340,29 +385,32 @@ int letter_rain_draw(letter_rain_t *game) {
     /* Update board last position */
     game->board.last_x = game->board.x;
     
-    /* Draw UI info in a fixed area */
-    /* Clear the UI area first */
-    if (draw_filled_rectangle(10, 10, 300, 200, 0x1a1a2e) != 0)
-        return 1;
-    
-    char status[100];
-    sprintf(status, "Letter Collection Status:");
-    if (draw_string_scaled(20, 20, status, 0x00FF88, 1) != 0)
-        return 1;
+    /* Status panel on top of the rain: only rows that changed or that a letter went over */
+    if (game->panel_dirty & PANEL_TITLE_BIT) {
+        if (draw_filled_rectangle(PANEL_X, PANEL_TITLE_Y, PANEL_WIDTH, PANEL_ROW_HEIGHT, 0x1a1a2e) != 0)
+            return 1;
+        if (draw_string_scaled(PANEL_TEXT_X, PANEL_TITLE_Y, "Letter Collection Status:", 0x00FF88, 1) != 0)
+            return 1;
+    }
     
-    /* Show counters for letters that have been caught at least once */
-    int line_y = 40;
-    for (int i = 0; i < 26; i++) {
-        if (game->letter_counters[i] > 0) {
-            char letter_info[20];
-            sprintf(letter_info, "%c: %d/2", 'A' + i, game->letter_counters[i]);
-            
-            uint32_t color = (game->letter_counters[i] >= 2) ? 0x00FF00 : 0xFFFF00;
-            if (draw_string_scaled(20, line_y, letter_info, color, 1) != 0)
-                return 1;
-            line_y += 15;
-        }
+    uint32_t rows = game->panel_dirty & ~PANEL_TITLE_BIT;
+    while (rows != 0) {
+        int row = __builtin_ctz(rows);
+        rows &= rows - 1;
+        
+        int letter_index = game->panel_letter[row] - 'A';
+        int row_y = PANEL_ROWS_Y + row * PANEL_ROW_HEIGHT;
+        char letter_info[20];
+        sprintf(letter_info, "%c: %d/%d", game->panel_letter[row], game->letter_counters[letter_index],
+                game->catches_to_win);
+        
+        uint32_t color = (game->letter_counters[letter_index] >= game->catches_to_win) ? 0x00FF00 : 0xFFFF00;
+        if (draw_filled_rectangle(PANEL_X, row_y, PANEL_WIDTH, PANEL_ROW_HEIGHT, 0x1a1a2e) != 0)
+            return 1;
+        if (draw_string_scaled(PANEL_TEXT_X, row_y, letter_info, color, 1) != 0)
+            return 1;
     }
+    game->panel_dirty = 0;
     
     return 0;
 }
@@ -375,18 +423,14 @@ int letter_rain_handle_input(letter_rain_t *game, uint8_t scancode) {
         case A_MAKE: // Move board left
             if (game->board.x > BOARD_SPEED) {
                 game->board.x -= BOARD_SPEED;
-                if (game->board.sprite != NULL) {
-                    set_sprite_position(game->board.sprite, game->board.x, game->board.y);
-                }
+                request_page_redraw();
             }
             break;
             
         case D_MAKE: // Move board right
             if (game->board.x < (int)get_h_res() - game->board.width - BOARD_SPEED) {
                 game->board.x += BOARD_SPEED;
-                if (game->board.sprite != NULL) {
-                    set_sprite_position(game->board.sprite, game->board.x, game->board.y);
-                }
+                request_page_redraw();
             }
             break;
     }
@@ -394,25 +438,18 @@ int letter_rain_handle_input(letter_rain_t *game, uint8_t scancode) {
     return 0;
 }
 
-bool check_letter_board_collision(falling_letter_t *letter, board_t *board) {
-    if (letter == NULL || letter->sprite == NULL || board == NULL)
+bool check_letter_board_collision(const letter_pool_t *pool, int i, const board_t *board) {
+    if (pool == NULL || board == NULL)
         return false;
     
-    int letter_x = letter->sprite->x;
-    int letter_y = letter->sprite->y;
-    int letter_w = letter->sprite->width;
-    int letter_h = letter->sprite->height;
-    
-    int board_x = board->x;
-    int board_y = board->y;
-    int board_w = board->width;
-    int board_h = board->height;
+    int letter_x = pool->x[i];
+    int letter_y = FP_TO_INT(pool->y_fp[i]);
     
     // Check for collision using AABB (Axis-Aligned Bounding Box)
-    return (letter_x < board_x + board_w &&
-            letter_x + letter_w > board_x &&
-            letter_y < board_y + board_h &&
-            letter_y + letter_h > board_y);
+    return (letter_x < board->x + board->width &&
+            letter_x + LETTER_SIZE > board->x &&
+            letter_y < board->y + board->height &&
+            letter_y + LETTER_SIZE > board->y);
 }
 
 void letter_rain_cleanup(letter_rain_t *game) {
@@ -420,22 +457,10 @@ void letter_rain_cleanup(letter_rain_t *game) {
         return;
     
     // Cleanup falling letters - erase them first
-    for (int i = 0; i < MAX_FALLING_LETTERS; i++) {
-        if (game->letters[i].active && game->letters[i].sprite != NULL) {
-            /* Erase sprite before cleanup */
-            erase_letter_sprite(game->letters[i].sprite->x, game->letters[i].sprite->y, 16, 16);
-            destroy_sprite(game->letters[i].sprite);
-            game->letters[i].sprite = NULL;
-        }
-        game->letters[i].active = false;
-        game->letters[i].last_x = -1;
-        game->letters[i].last_y = -1;
+    while (game->letters.count > 0) {
+        release_letter(game, game->letters.count - 1);
     }
     
     // Cleanup board - erase it first
-    if (game->board.sprite != NULL) {
-        erase_letter_sprite(game->board.x, game->board.y, game->board.width, game->board.height);
-        destroy_sprite(game->board.sprite);
-        game->board.sprite = NULL;
-    }
+    erase_letter_sprite(game->board.x, game->board.y, game->board.width, game->board.height);
 }
@@ -3,13 +3,47 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "sprite.h"
+#include "hrclock.h"
+#include "rng.h"
 
 #define MAX_FALLING_LETTERS 10
+#define LETTER_SIZE 16  /* Letters are LETTER_SIZE x LETTER_SIZE squares */
 #define BOARD_WIDTH 100
 #define BOARD_HEIGHT 25  /* Reduzido para metade */
-#define LETTER_FALL_SPEED 2
+#define LETTER_FALL_SPEED 120  /* Pixels per second */
+
+/* Fixed-timestep simulation */
+#define LETTER_RAIN_STEP_HZ 120                              /* Simulation steps per second */
+#define LETTER_RAIN_STEP_NS (NS_PER_SEC / LETTER_RAIN_STEP_HZ) /* Length of one step */
+#define LETTER_RAIN_MAX_STEPS 12                             /* Steps run per update at most (stall clamp) */
+#define LETTER_SPAWN_STEPS 70                                /* Steps between letter spawns (~583 ms) */
+
+/* 16.16 fixed-point positions */
+#define FP_SHIFT 16
+#define FP_ONE (1 << FP_SHIFT)
+#define INT_TO_FP(v) ((int32_t)(v) * FP_ONE)
+#define FP_TO_INT(v) ((v) >> FP_SHIFT)
+#define LETTER_FALL_STEP_FP (LETTER_FALL_SPEED * FP_ONE / LETTER_RAIN_STEP_HZ) /* Fall per step */
 #define BOARD_SPEED 35   /* Muito mais rápido */
+#define CATCHES_TO_WIN 2 /* Catches of the same letter that end the rain */
+
+/* Letter storm (hard mode): a dense rain at varying speeds */
+#define LETTER_POOL_SIZE 2048          /* Letters the pool holds (multiple of LETTER_LANES) */
+#define LETTER_LANES 4                 /* int32 lanes per vector in the update loops */
+#define LETTER_STORM_SPAWN 2           /* Letters spawned every step (240 per second) */
+#define LETTER_STORM_MIN_SPEED 60      /* Pixels per second */
+#define LETTER_STORM_MAX_SPEED 240
+#define LETTER_STORM_CATCHES 5         /* Catches of the same letter that end the storm */
+#define DIRTY_BAND_SHIFT 4             /* Screen rows per dirty band: 16 */
+
+/* Status panel: a title and one row per caught letter, drawn over the rain */
+#define PANEL_X 10
+#define PANEL_WIDTH 300
+#define PANEL_TEXT_X 20
+#define PANEL_TITLE_Y 20
+#define PANEL_ROWS_Y 40
+#define PANEL_ROW_HEIGHT 15
+#define PANEL_TITLE_BIT (1u << 31) /* Title in panel_dirty, rows use bits 0..25 */
 
 /**
  * @brief Letter probabilities (multiplied by 100 for integer math)
@@ -25,15 +59,22 @@ typedef enum {
 } letter_probability_t;
 
 /**
- * @brief Falling letter structure
+ * @brief Fixed pool of falling letters, one array per field
+ *
+ * Letters in play are packed in slots [0, count), so the vector loops run
+ * without masks; removing a letter moves the last one into its slot.
  */
 typedef struct {
-    char letter;        // The letter character
-    Sprite *sprite;     // Sprite for the letter
-    bool active;        // Whether this letter is falling
-    uint32_t color;     // Letter color
-    int last_x, last_y; // Previous position for smooth erasing
-} falling_letter_t;
+    int32_t y_fp[LETTER_POOL_SIZE] __attribute__((aligned(16)));      // Fixed-point Y after the last step
+    int32_t prev_y_fp[LETTER_POOL_SIZE] __attribute__((aligned(16))); // Fixed-point Y after the step before
+    int32_t vy_fp[LETTER_POOL_SIZE] __attribute__((aligned(16)));     // Fixed-point fall per step
+    int16_t x[LETTER_POOL_SIZE];       // Screen X
+    int16_t last_x[LETTER_POOL_SIZE];  // Previous drawn position for smooth erasing, -1 if none
+    int16_t last_y[LETTER_POOL_SIZE];
+    char glyph[LETTER_POOL_SIZE];      // The letter character
+    uint32_t color[LETTER_POOL_SIZE];  // Letter color
+    int count;                         // Letters in play
+} letter_pool_t;
 
 /**
  * @brief Board structure for catching letters
@@ -41,7 +82,6 @@ typedef struct {
 typedef struct {
     int x, y;           // Board position
     int width, height;  // Board dimensions
-    Sprite *sprite;     // Board sprite
     int last_x;         // Previous X position for smooth erasing
 } board_t;
 
@@ -49,13 +89,25 @@ typedef struct {
  * @brief Letter rain game state
  */
 typedef struct {
-    falling_letter_t letters[MAX_FALLING_LETTERS];
+    letter_pool_t letters;
+    bool storm;              // Hard mode: dense rain at varying speeds
+    int max_letters;         // Letters in play at most
+    int catches_to_win;      // Catches of the same letter that end the rain
+    uint64_t dirty_bands;    // Row bands (1 << DIRTY_BAND_SHIFT rows) erased since the last draw
     board_t board;
     char caught_letter;     // The letter that was caught twice
     bool game_over;         // Game over flag
-    uint32_t frame_counter; // For timing letter spawning
-    uint32_t spawn_rate;    // Frames between letter spawns
+    uint64_t last_update_ns; // Clock time of the previous update
+    uint64_t accumulator_ns; // Real time not yet simulated (less than one step after an update)
+    uint32_t steps_to_spawn; // Simulation steps until the next letter spawn
+    int32_t alpha_fp;        // Fixed-point fraction of a step to interpolate when drawing
+    rng_t letter_rng;        // Stream of spawned letters
+    rng_t spawn_rng;         // Stream of spawn positions
     int letter_counters[26]; // Counter for each letter (A=0, B=1, ..., Z=25)
+    int8_t panel_row[26];    // Status panel row of each letter, -1 until first caught
+    char panel_letter[26];   // Letter shown on each panel row
+    int panel_rows;          // Rows in the status panel
+    uint32_t panel_dirty;    // Panel rows to redraw (bit per row, PANEL_TITLE_BIT for the title)
     bool first_draw;        // Flag to indicate first draw (for initial clear)
 } letter_rain_t;
 
@@ -63,12 +115,13 @@ typedef struct {
  * @brief Initialize the letter rain game
  * 
  * @param game Pointer to letter rain game structure
+ * @param storm Hard mode (letter storm) instead of the normal rain
  * @return 0 on success, non-zero otherwise
  */
-int letter_rain_init(letter_rain_t *game);
+int letter_rain_init(letter_rain_t *game, bool storm);
 
 /**
- * @brief Update the letter rain game state
+ * @brief Advance the letter rain simulation by whole fixed steps up to the current time
  * 
  * @param game Pointer to letter rain game structure
  * @return 0 if game continues, 1 if game over
@@ -102,36 +155,19 @@ void letter_rain_cleanup(letter_rain_t *game);
 /**
  * @brief Get a random letter based on Portuguese frequency
  * 
+ * @param rng Stream to draw from
  * @return Random letter character
  */
-char get_random_letter();
-
-/**
- * @brief Create a letter sprite for the given character
- * 
- * @param letter The letter character
- * @param x Initial X position
- * @param y Initial Y position
- * @return Pointer to created sprite or NULL on error
- */
-Sprite *create_letter_sprite(char letter, int x, int y);
-
-/**
- * @brief Create board sprite
- * 
- * @param x Initial X position
- * @param y Initial Y position
- * @return Pointer to created sprite or NULL on error
- */
-Sprite *create_board_sprite(int x, int y);
+char get_random_letter(rng_t *rng);
 
 /**
  * @brief Check if a falling letter collides with the board
  * 
- * @param letter Pointer to falling letter
+ * @param pool Letter pool
+ * @param i Slot of the letter
  * @param board Pointer to board
  * @return true if collision detected, false otherwise
  */
-bool check_letter_board_collision(falling_letter_t *letter, board_t *board);
+bool check_letter_board_collision(const letter_pool_t *pool, int i, const board_t *board);
 
 #endif /* _LETTER_RAIN_H_ */
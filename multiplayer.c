@@ -0,0 +1,309 @@
+#include "multiplayer.h"
+#include "reliable.h"
+#include "rng.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MP_PROGRESS_INTERVAL_NS (NS_PER_SEC / MP_PROGRESS_RATE_HZ)
+
+/* Connection state */
+static bool mp_peer_connected = false; /* The other player's CONNECT arrived */
+static bool mp_session_connected = false; /* Handshake completed */
+static uint16_t mp_session_id = 0; /* Unique identifier for each multiplayer session, sent in every frame */
+static uint32_t mp_nonce = 0;      /* Sent in CONNECT, the larger nonce takes the host role */
+static uint64_t mp_seed = 0;       /* Our half of the shared game seed, sent in CONNECT */
+static uint32_t mp_peer_nonce = 0;
+static uint16_t mp_peer_session = 0;
+static uint64_t mp_peer_seed = 0;
+static bool mp_host = false;       /* Player 1 (decided by the handshake, the same on both sides) */
+
+/* Clock synchronization: the host's clock is the session clock, host time = local time + offset */
+static uint64_t mp_connected_ns = 0;  /* When the other player's CONNECT arrived */
+static int mp_sync_samples = 0;       /* TIME_RESPONSEs received */
+static uint64_t mp_sync_rtt_ns = 0;   /* Round trip of the best (fastest) sample */
+static int64_t mp_peer_offset_ns = 0; /* Their clock minus ours, from the best sample */
+static int64_t mp_clock_offset_ns = 0;
+static uint64_t mp_ready_ns[MP_PHASE_COUNT][2]; /* When we [0] and they [1] got ready, host clock (0 = not yet) */
+
+/* Live progress: what we last sent, and the other player's (final once they finished) */
+static int mp_sent_score = -1;          /* -1 until the first PROGRESS of the session */
+static int mp_sent_words = 0;
+static int mp_sent_remaining = 0;
+static uint64_t mp_sent_ns = 0;
+static mp_progress_t mp_other = {"---", 0, 0, 0};
+static bool mp_other_finished = false;  /* Their GAME_FINISHED arrived (possibly while we played) */
+
+/* Message types handled by the current mp_receive_* call */
+static uint32_t mp_received = 0;
+
+void mp_reset() {
+  mp_peer_connected = false;
+  mp_session_connected = false;
+  mp_other_finished = false;
+  mp_sent_score = -1;
+  mp_other = (mp_progress_t){"---", 0, 0, 0};
+
+  /* New session ID, nonce and seed half. The clock is mixed in so two VMs
+   * started with the same RNG_SEED still draw different values */
+  static rng_t session_rng;
+  static bool session_rng_seeded = false;
+  if (!session_rng_seeded) {
+    rng_stream(&session_rng, RNG_STREAM_SESSION);
+    session_rng_seeded = true;
+  }
+  uint64_t now = hrclock_now_ns();
+  uint16_t previous_session = mp_session_id;
+  mp_session_id = (uint16_t)(rng_next(&session_rng) ^ now);
+  if (mp_session_id == previous_session) mp_session_id++; /* Frames of the last session stay stale */
+  mp_nonce = rng_next(&session_rng) ^ (uint32_t)(now >> 10);
+  mp_seed = (((uint64_t)rng_next(&session_rng) << 32) | rng_next(&session_rng)) ^ now;
+  mp_host = false;
+  mp_sync_samples = 0;
+  mp_clock_offset_ns = 0;
+  memset(mp_ready_ns, 0, sizeof(mp_ready_ns));
+  rel_reset(mp_session_id);
+
+  printf("Generated session ID: %u\n", mp_session_id);
+}
+
+int mp_send_connect() {
+  uint8_t payload[MSG_CONNECT_SIZE];
+  proto_put_u32(payload, mp_nonce);
+  proto_put_u64(payload + 4, mp_seed);
+  if (rel_send(MSG_CONNECT, payload, sizeof(payload), hrclock_now_ns()) != 0) {
+    printf("ERROR: Failed to send CONNECT message!\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* Both CONNECTs delivered: agree on the roles and the game seed without another message.
+ * Both sides compare the same (nonce, session) pairs and combine the same seed halves */
+static void mp_negotiate_session() {
+  mp_host = mp_nonce != mp_peer_nonce ? mp_nonce > mp_peer_nonce : mp_session_id > mp_peer_session;
+  if (mp_nonce == mp_peer_nonce && mp_session_id == mp_peer_session) {
+    printf("WARNING: handshake tie, both players take the guest role\n");
+  }
+
+  /* Categories, letters and spawn positions now follow the same streams on both VMs */
+  rng_init(mp_seed ^ mp_peer_seed);
+  printf("Session negotiated: player %d, shared seed %llu\n", mp_host ? 1 : 2,
+         (unsigned long long)rng_game_seed());
+
+  /* Shared start times are on the host's clock */
+  mp_clock_offset_ns = mp_host ? 0 : mp_peer_offset_ns;
+  printf("Clock sync: %d samples, RTT %llu us, offset %lld us\n", mp_sync_samples,
+         (unsigned long long)(mp_sync_rtt_ns / 1000), (long long)(mp_clock_offset_ns / 1000));
+}
+
+bool mp_update_connecting() {
+  if (mp_session_connected) return false;
+  uint64_t now = hrclock_now_ns();
+
+  /* Our CONNECT goes out again until acknowledged */
+  rel_tick(now);
+
+  /* Once the other player is there, sample its clock on every call */
+  bool synced = mp_sync_samples >= MP_SYNC_SAMPLES ||
+                (mp_peer_connected && now - mp_connected_ns > MP_SYNC_TIMEOUT_NS);
+  if (mp_peer_connected && !synced) {
+    uint8_t payload[MSG_TIME_REQUEST_SIZE];
+    proto_put_u64(payload, now);
+    proto_send(MSG_TIME_REQUEST, mp_session_id, 0, payload, sizeof(payload));
+  }
+
+  /* Both CONNECTs delivered and the clock sampled: each side knows the other is there */
+  if (mp_peer_connected && rel_all_delivered() && synced) {
+    mp_negotiate_session();
+    mp_session_connected = true;
+    return true;
+  }
+  return false;
+}
+
+bool mp_connected() {
+  return mp_session_connected;
+}
+
+void mp_tick() {
+  rel_tick(hrclock_now_ns());
+}
+
+bool mp_all_delivered() {
+  return rel_all_delivered();
+}
+
+void mp_sync_ready(mp_phase_t phase) {
+  if (!mp_session_connected || mp_ready_ns[phase][0] != 0) return;
+
+  uint64_t now = hrclock_now_ns();
+  mp_ready_ns[phase][0] = now + (uint64_t)mp_clock_offset_ns;
+
+  uint8_t payload[MSG_READY_SIZE];
+  payload[0] = (uint8_t)phase;
+  proto_put_u64(payload + 1, mp_ready_ns[phase][0]);
+  if (rel_send(MSG_READY, payload, sizeof(payload), now) != 0) {
+    printf("ERROR: Failed to send READY message!\n");
+  }
+}
+
+uint64_t mp_sync_start_ns(mp_phase_t phase) {
+  uint64_t ours = mp_ready_ns[phase][0];
+  uint64_t theirs = mp_ready_ns[phase][1];
+  if (ours == 0 || theirs == 0) return 0;
+
+  /* Both sides compute the same host time, then convert it to their own clock */
+  uint64_t start = (ours > theirs ? ours : theirs) + MP_START_MARGIN_NS;
+  return start - (uint64_t)mp_clock_offset_ns;
+}
+
+bool mp_send_progress(const char *initials, int score, int words, int remaining_seconds) {
+  /* Only changes are sent, coalesced to MP_PROGRESS_RATE_HZ; a change held back goes out on a later call.
+   * The countdown changes every second, which also repairs a lost (unacknowledged) PROGRESS */
+  if (score == mp_sent_score && words == mp_sent_words && remaining_seconds == mp_sent_remaining) return false;
+  uint64_t now = hrclock_now_ns();
+  if (mp_sent_score >= 0 && now - mp_sent_ns < MP_PROGRESS_INTERVAL_NS) return false;
+
+  uint8_t payload[MSG_PROGRESS_SIZE];
+  memcpy(payload, initials, 3);
+  proto_put_u32(payload + 3, (uint32_t)score);
+  payload[7] = (uint8_t)words;
+  payload[8] = (uint8_t)remaining_seconds;
+  if (proto_send(MSG_PROGRESS, mp_session_id, 0, payload, sizeof(payload)) != 0) return false;
+
+  mp_sent_score = score;
+  mp_sent_words = words;
+  mp_sent_remaining = remaining_seconds;
+  mp_sent_ns = now;
+  return true;
+}
+
+int mp_send_finished(const char *initials, int score) {
+  /* Initials and score, retransmitted until acknowledged */
+  uint8_t payload[MSG_GAME_FINISHED_SIZE];
+  memcpy(payload, initials, 3);
+  proto_put_u32(payload + 3, (uint32_t)score);
+
+  if (rel_send(MSG_GAME_FINISHED, payload, sizeof(payload), hrclock_now_ns()) != 0) {
+    printf("ERROR: Failed to send GAME_FINISHED message!\n");
+    return 1;
+  }
+  printf("*** GAME_FINISHED sent (%.3s, %d) with session ID %u ***\n", initials, score, mp_session_id);
+  return 0;
+}
+
+const mp_progress_t *mp_opponent() {
+  return &mp_other;
+}
+
+bool mp_opponent_finished() {
+  return mp_other_finished;
+}
+
+/* Printable initials from a payload */
+static void copy_initials(char initials[4], const uint8_t *payload) {
+  for (int i = 0; i < 3; i++) {
+    char c = (char)payload[i];
+    initials[i] = (c >= 32 && c <= 126) ? c : '?';
+  }
+  initials[3] = '\0';
+}
+
+static void mp_on_connect(const proto_frame_t *frame) {
+  /* Payload: nonce, seed */
+  mp_peer_nonce = proto_get_u32(frame->payload);
+  mp_peer_seed = proto_get_u64(frame->payload + 4);
+  mp_peer_session = frame->session;
+  mp_peer_connected = true;
+  mp_connected_ns = hrclock_now_ns();
+  mp_received |= 1u << MSG_CONNECT;
+}
+
+static void mp_on_late_connect(const proto_frame_t *frame) {
+  /* The session was negotiated already: a CONNECT now is from a peer that restarted */
+  printf("Ignoring CONNECT from session %u, already connected\n", frame->session);
+}
+
+static void mp_on_time_request(const proto_frame_t *frame) {
+  /* Echo their send time with our receive and send times */
+  uint8_t payload[MSG_TIME_RESPONSE_SIZE];
+  memcpy(payload, frame->payload, 8);
+  proto_put_u64(payload + 8, hrclock_now_ns());
+  proto_put_u64(payload + 16, hrclock_now_ns());
+  proto_send(MSG_TIME_RESPONSE, mp_session_id, 0, payload, sizeof(payload));
+}
+
+static void mp_on_time_response(const proto_frame_t *frame) {
+  /* NTP: t1 request sent, t2 request received, t3 response sent, t4 response received */
+  uint64_t t4 = hrclock_now_ns();
+  uint64_t t1 = proto_get_u64(frame->payload);
+  uint64_t t2 = proto_get_u64(frame->payload + 8);
+  uint64_t t3 = proto_get_u64(frame->payload + 16);
+  if (t1 > t4 || t2 > t3 || t4 - t1 < t3 - t2) return; /* Not one of our requests */
+
+  /* The fastest round trip has the least room for asymmetric delays */
+  uint64_t rtt = (t4 - t1) - (t3 - t2);
+  if (mp_sync_samples == 0 || rtt < mp_sync_rtt_ns) {
+    mp_sync_rtt_ns = rtt;
+    mp_peer_offset_ns = ((int64_t)(t2 - t1) + (int64_t)(t3 - t4)) / 2;
+  }
+  mp_sync_samples++;
+}
+
+static void mp_on_ready(const proto_frame_t *frame) {
+  /* Payload: phase, time on the host clock */
+  if (frame->payload[0] < MP_PHASE_COUNT) {
+    mp_ready_ns[frame->payload[0]][1] = proto_get_u64(frame->payload + 1);
+    mp_received |= 1u << MSG_READY;
+  }
+}
+
+static void mp_on_game_finished(const proto_frame_t *frame) {
+  /* Payload: initials[3], score */
+  copy_initials(mp_other.initials, frame->payload);
+  mp_other.score = (int32_t)proto_get_u32(frame->payload + 3);
+  mp_other_finished = true;
+  mp_received |= 1u << MSG_GAME_FINISHED;
+}
+
+static void mp_on_progress(const proto_frame_t *frame) {
+  /* Payload: initials[3], score, words, remaining seconds (their final score wins once it arrived) */
+  if (mp_other_finished) return;
+  copy_initials(mp_other.initials, frame->payload);
+  mp_other.score = (int32_t)proto_get_u32(frame->payload + 3);
+  mp_other.words = frame->payload[7];
+  mp_other.remaining_seconds = frame->payload[8];
+  mp_received |= 1u << MSG_PROGRESS;
+}
+
+/* Messages handled while connecting: the other player may already be counting down */
+static const proto_handler_t mp_connecting_handlers[MSG_TYPE_COUNT] = {
+  [MSG_CONNECT] = mp_on_connect,
+  [MSG_TIME_REQUEST] = mp_on_time_request,
+  [MSG_TIME_RESPONSE] = mp_on_time_response,
+  [MSG_READY] = mp_on_ready,
+  [MSG_GAME_FINISHED] = mp_on_game_finished,
+  [MSG_PROGRESS] = mp_on_progress,
+};
+
+/* Messages handled once connected: the other player may finish first.
+ * Like every table given to rel_receive, it has a handler for each reliable type */
+static const proto_handler_t mp_connected_handlers[MSG_TYPE_COUNT] = {
+  [MSG_CONNECT] = mp_on_late_connect,
+  [MSG_GAME_FINISHED] = mp_on_game_finished,
+  [MSG_PROGRESS] = mp_on_progress,
+  [MSG_TIME_REQUEST] = mp_on_time_request, /* The other player may still be sampling */
+  [MSG_READY] = mp_on_ready,
+};
+
+uint32_t mp_receive_connecting() {
+  mp_received = 0;
+  rel_receive(mp_connecting_handlers, hrclock_now_ns());
+  return mp_received;
+}
+
+uint32_t mp_receive_connected() {
+  mp_received = 0;
+  rel_receive(mp_connected_handlers, hrclock_now_ns());
+  return mp_received;
+}
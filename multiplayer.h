@@ -0,0 +1,150 @@
+#ifndef _MULTIPLAYER_H_
+#define _MULTIPLAYER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "protocol.h"
+#include "hrclock.h"
+
+/*
+ * 2 player session over the reliable link, without any drawing: the CONNECT
+ * handshake (roles and shared game seed), clock synchronization with the
+ * other player, shared phase starts (READY), live progress and the final
+ * results. The handler tables used while connecting and once connected live
+ * here, so host tools drive the same code as the game.
+ *
+ * Time comes from hrclock_now_ns.
+ */
+
+#define MP_PROGRESS_RATE_HZ 20                  /* Most PROGRESS messages sent per second */
+#define MP_SYNC_SAMPLES 8                       /* Clock samples taken before the connection completes */
+#define MP_SYNC_TIMEOUT_NS (2 * NS_PER_SEC)     /* Connect with fewer samples after this long */
+#define MP_START_MARGIN_NS (500 * NS_PER_MS)    /* A shared start is this long after the later READY */
+
+/**
+ * @brief Progress of the other player, streamed during the word phase (final once they finished)
+ */
+typedef struct {
+  char initials[4];       /* "---" until their first PROGRESS arrives */
+  int score;
+  int words;              /* Words found */
+  int remaining_seconds;  /* Their countdown */
+} mp_progress_t;
+
+/**
+ * @brief Points of a 2 player game where both players start together
+ */
+typedef enum {
+  MP_PHASE_COUNTDOWN,  /* Countdown (then letter rain), after both entered their initials */
+  MP_PHASE_WORDS,      /* Word phase, after both saw the category */
+  MP_PHASE_COUNT
+} mp_phase_t;
+
+/**
+ * @brief Start a new session: new session id, nonce and seed half, nothing received yet
+ */
+void mp_reset();
+
+/**
+ * @brief Announce ourselves with CONNECT (retransmitted until acknowledged)
+ *
+ * @return 0 on success, non-zero otherwise
+ */
+int mp_send_connect();
+
+/**
+ * @brief Advance the connection: retransmits, and clock samples once the other player is there
+ *
+ * When both CONNECTs are delivered and the clock is sampled, the roles and
+ * the shared game seed are negotiated (rng_init) and the session is connected.
+ *
+ * @return true once, when the session gets connected
+ */
+bool mp_update_connecting();
+
+/**
+ * @brief Check if the handshake completed
+ *
+ * @return true from the connection until the next mp_reset
+ */
+bool mp_connected();
+
+/**
+ * @brief Process received frames while connecting
+ *
+ * @return Bit (1 << type) set for each message type handled
+ */
+uint32_t mp_receive_connecting();
+
+/**
+ * @brief Process received frames once connected (also on the results screen)
+ *
+ * @return Bit (1 << type) set for each message type handled
+ */
+uint32_t mp_receive_connected();
+
+/**
+ * @brief Retransmit what timed out
+ */
+void mp_tick();
+
+/**
+ * @brief Check if every reliable message we sent was acknowledged
+ *
+ * @return true if nothing is waiting for an acknowledgement
+ */
+bool mp_all_delivered();
+
+/**
+ * @brief Tell the other player we are ready for a phase (once per phase, only when connected)
+ *
+ * @param phase Phase
+ */
+void mp_sync_ready(mp_phase_t phase);
+
+/**
+ * @brief Get the shared start time of a phase
+ *
+ * Both players start at the same instant on the host's clock, shortly after the
+ * later of them got ready; the result is converted to our clock.
+ *
+ * @param phase Phase
+ * @return Start time on hrclock_now_ns's clock, 0 until both players are ready
+ */
+uint64_t mp_sync_start_ns(mp_phase_t phase);
+
+/**
+ * @brief Send our progress if it changed (at most MP_PROGRESS_RATE_HZ times per second)
+ *
+ * @param initials Our initials (3 characters)
+ * @param score Our score
+ * @param words Words found
+ * @param remaining_seconds Our countdown
+ * @return true if a PROGRESS went out
+ */
+bool mp_send_progress(const char *initials, int score, int words, int remaining_seconds);
+
+/**
+ * @brief Send our final score (retransmitted until acknowledged)
+ *
+ * @param initials Our initials (3 characters)
+ * @param score Our final score
+ * @return 0 on success, non-zero otherwise
+ */
+int mp_send_finished(const char *initials, int score);
+
+/**
+ * @brief Get the other player's progress, or final score once they finished
+ *
+ * @return Progress of the current session
+ */
+const mp_progress_t *mp_opponent();
+
+/**
+ * @brief Check if the other player's GAME_FINISHED arrived
+ *
+ * @return true once their final score is known
+ */
+bool mp_opponent_finished();
+
+#endif /* _MULTIPLAYER_H_ */
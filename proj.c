@@ -11,11 +11,21 @@
 #include "utils.h"
 #include "singleplayer.h"
 #include "serial.h"
+#include "states.h"
+#include "hrclock.h"
+#include "dictionary.h"
+#include "rng.h"
+#include "reliable.h"
+#include "trace.h"
+#include <string.h>
+#include <time.h>
 
 uint16_t mode;
 uint8_t kbd_bit_no = 0;
 uint8_t mouse_bit_no = 0;
 uint8_t timer_bit_no = 0;
+uint8_t serial_bit_no = 0;
+bool serial_irq = false; /* COM1 interrupts subscribed, otherwise the link is polled */
 
 // Define some colors for different bit depths
 #define COLOR_WHITE 0xFFFFFF
@@ -106,27 +116,80 @@ int (proj_main_loop)(int argc, char* argv[])
   }
   printf("Timer subscribed successfully with bit_no=%d\n", timer_bit_no);
   
+  /* Subscribe serial port interrupts - the game still runs without them */
+  printf("Subscribing serial port interrupts...\n");
+  serial_irq = serial_subscribe_int(&serial_bit_no) == 0;
+  if (serial_irq) {
+    printf("Serial port subscribed successfully with bit_no=%d\n", serial_bit_no);
+  } else {
+    printf("Serial port interrupts unavailable, polling the link on timer ticks\n");
+  }
+  
+  /* Calibrate the clock used for all game timing (falls back to timer ticks) */
+  printf("Calibrating clock...\n");
+  hrclock_init();
+  
+  /* Seed every random stream; the printed seed replays the session */
+#ifdef RNG_SEED
+  rng_init(RNG_SEED);
+#else
+  rng_init(((uint64_t)time(NULL) << 32) ^ hrclock_now_ns());
+#endif
+  
+  /* "lcom_run proj trace" records the multiplayer protocol (decode with tools/trace_decode) */
+  for (int i = 0; i < argc; i++) {
+    if (strcmp(argv[i], "trace") == 0) {
+      printf("Protocol tracing enabled\n");
+      trace_start(hrclock_now_ns);
+    }
+  }
+  
   /* Initialize font system */
   font_init();
   
-  /* Set initial state and draw the main page */
-  set_game_state(STATE_MAIN_MENU);
-  if (draw_current_page(400, 300) != 0) {
-    printf("Error drawing initial page\n");
-    goto cleanup_and_exit;
+  /* Map the word dictionary */
+  if (dictionary_load() != 0) {
+    printf("Error loading dictionary\n");
+    serial_unsubscribe_int();
+    timer_unsubscribe_int();
+    mouse_disable();
+    kbd_unsubscribe_int();
+    exit_graphics_mode();
+    return 1;
   }
   
+  /* Set initial state, the main page is drawn by the first loop iteration */
+  set_game_state(STATE_MAIN_MENU);
+  
   int ipc_status;
   message msg;
-  bool running = true;
+  uint64_t wake_ns = hrclock_now_ns(); /* When the loop last woke up, for per-state CPU time */
   
   /* Main loop */
   printf("=== Entering main loop ===\n");
   printf("Press ESC to exit graphics mode\n");
   
-  while (running) {
+  while (!states_quit_requested()) {
+    /* Render only when some input, message or timer changed what is on screen */
+    if (page_redraw_requested()) {
+      /* Drawing may itself change state, so loop until stable */
+      int redraws = 0;
+      while (page_redraw_requested() && redraws < 4) {
+        clear_page_redraw_request();
+        if (draw_current_page(mouse_get_x(), mouse_get_y()) != 0) {
+          printf("Error drawing page for state %d\n", get_game_state());
+        }
+        redraws++;
+      }
+    }
+    
+    /* Everything since the last wake up was work for the current state */
+    states_add_busy_ns(hrclock_elapsed_ns(wake_ns));
+    
     /* Wait for interrupt */
-    if (driver_receive(ANY, &msg, &ipc_status) != 0) {
+    int r = driver_receive(ANY, &msg, &ipc_status);
+    wake_ns = hrclock_now_ns();
+    if (r != 0) {
       printf("Error receiving message\n");
       continue;
     }
@@ -134,321 +197,34 @@ int (proj_main_loop)(int argc, char* argv[])
     if (is_ipc_notify(ipc_status)) {
       switch (_ENDPOINT_P(msg.m_source)) {
         case HARDWARE:
-          /* Timer interrupt */
+          /* Serial interrupt - received bytes are handed over as soon as they arrive */
+          if (serial_irq && (msg.m_notify.interrupts & BIT(serial_bit_no))) {
+            serial_ih();
+            if (serial_has_data()) states_serial();
+          }
+          
+          /* Timer interrupt - the simulation advances (the link is polled without serial interrupts) */
           if (msg.m_notify.interrupts & BIT(timer_bit_no)) {
             timer_int_handler();
-            
-            /* Handle countdown updates for single player mode */
-            if (get_game_state() == STATE_SP_COUNTDOWN) {
-              jogo_t *game = get_current_game();
-              bool countdown_finished = game_update_countdown(game);
-              
-              if (countdown_finished) {
-                printf("Countdown finished, starting letter rain...\n");
-                int lr_init_result = game_start_letter_rain(game);
-                
-                if (lr_init_result != 0) {
-                  printf("Error starting letter rain, using fallback\n");
-                  game->state = GAME_STATE_LETTER_RAIN;
-                }
-                
-                set_game_state(STATE_SP_LETTER_RAIN);
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              } else {
-                /* Redraw countdown if number changed */
-                static uint8_t last_countdown_value = 255;
-                if (last_countdown_value != game->countdown) {
-                  last_countdown_value = game->countdown;
-                  uint16_t mouse_x = mouse_get_x();
-                  uint16_t mouse_y = mouse_get_y();
-                  draw_current_page(mouse_x, mouse_y);
-                }
-              }
-            } 
-            else if (get_game_state() == STATE_SP_ENTER_INITIALS) {
-              /* Keep initials screen updated for automatic transitions */
-              static int initials_redraw_counter = 0;
-              initials_redraw_counter++;
-              if (initials_redraw_counter >= 30) { /* Redraw every 0.5 seconds */
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-                initials_redraw_counter = 0;
-              }
-            }
-            else if (get_game_state() == STATE_SP_LETTER_RAIN) {
-              jogo_t *game = get_current_game();
-              int lr_result = game_update_letter_rain(game);
-              
-              if (lr_result == 1) {
-                /* Letter rain finished */
-                if (game->letra != 0) {
-                  printf("Letter rain finished, caught letter: %c\n", game->letra);
-                  set_game_state(STATE_SP_PLAYING);
-                } else {
-                  printf("Letter rain failed\n");
-                  reset_singleplayer();
-                  set_game_state(STATE_MAIN_MENU);
-                }
-                
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              } else {
-                /* Continue letter rain animation */
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              }
-            }
-            else if (get_game_state() == STATE_SP_PLAYING) {
-              extern singleplayer_game_t sp_game;
-              int sp_result = singleplayer_update(&sp_game);
-              
-              if (sp_result == 1) {
-                /* Game finished */
-                printf("Singleplayer game finished\n");
-                
-                /* Check if we're in multiplayer mode */
-                if (is_in_multiplayer_mode()) {
-                  printf("Multiplayer mode: transitioning to waiting screen\n");
-                  set_game_state(STATE_MP_WAITING_FOR_OTHER_PLAYER);
-                } else {
-                  printf("Single player mode: staying in results state\n");
-                  /* Note: score is saved automatically in singleplayer_draw_results */
-                  /* Game will stay in finished state until ESC is pressed */
-                }
-              }
-              
-              /* Always redraw to update timer */
-              uint16_t mouse_x = mouse_get_x();
-              uint16_t mouse_y = mouse_get_y();
-              draw_current_page(mouse_x, mouse_y);
-            }
-            else if (get_game_state() == STATE_MULTIPLAYER_TEST) {
-              /* Update multiplayer connection test every timer tick */
-              uint16_t mouse_x = mouse_get_x();
-              uint16_t mouse_y = mouse_get_y();
-              draw_current_page(mouse_x, mouse_y);
-            }
-            else if (get_game_state() == STATE_MP_WAITING_FOR_OTHER_PLAYER) {
-              /* Update multiplayer waiting screen every timer tick */
-              uint16_t mouse_x = mouse_get_x();
-              uint16_t mouse_y = mouse_get_y();
-              draw_current_page(mouse_x, mouse_y);
-            }
-            else if (get_game_state() == STATE_MP_RESULTS) {
-              /* Update multiplayer results screen every timer tick */
-              uint16_t mouse_x = mouse_get_x();
-              uint16_t mouse_y = mouse_get_y();
-              draw_current_page(mouse_x, mouse_y);
-            }
+            hrclock_tick();
+            if (!serial_irq && serial_poll() > 0) states_serial();
+            states_tick();
           }
           
           /* Keyboard interrupt */
           if (msg.m_notify.interrupts & BIT(kbd_bit_no)) {
             kbd_int_handler();
-            
-            /* Handle ESC key */
-            if (is_esc_key()) {
-              game_state_t current = get_game_state();
-              printf("ESC key pressed in state: %d\n", current);
-              
-              if (current == STATE_SP_ENTER_INITIALS || current == STATE_SP_COUNTDOWN || 
-                  current == STATE_SP_LETTER_RAIN || current == STATE_SP_PLAYING) {
-                /* Exit single player mode */
-                printf("Exiting single player mode...\n");
-                
-                if (current == STATE_SP_LETTER_RAIN) {
-                  jogo_t *game = get_current_game();
-                  game_cleanup_letter_rain(game);
-                }
-                
-                reset_singleplayer();
-                set_game_state(STATE_MAIN_MENU);
-                
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              } 
-              else if (current == STATE_MULTIPLAYER_TEST || current == STATE_MP_WAITING_FOR_OTHER_PLAYER) {
-                /* Exit multiplayer mode */
-                printf("Exiting multiplayer mode...\n");
-                serial_cleanup();
-                reset_multiplayer_connection();
-                set_game_state(STATE_MAIN_MENU);
-                
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              }
-              else if (current == STATE_MP_RESULTS) {
-                /* Exit multiplayer results screen */
-                printf("Exiting multiplayer results...\n");
-                reset_multiplayer_connection();
-                set_game_state(STATE_MAIN_MENU);
-                
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              }
-              else if (current != STATE_MAIN_MENU) {
-                /* Go back to main menu */
-                printf("Going back to main menu...\n");
-                set_game_state(STATE_MAIN_MENU);
-                
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              } 
-              else {
-                /* Exit application */
-                printf("ESC key detected, exiting...\n");
-                running = false;
-              }
-            }
-            
-            /* Handle keyboard input for different states */
-            game_state_t current_state = get_game_state();
-            
-            if (current_state == STATE_SP_ENTER_INITIALS) {
-              int kb_result = handle_initials_keyboard(last_scancode);
-              
-              if (kb_result == 1) {
-                /* Initials confirmed */
-                printf("Initials confirmed, starting countdown...\n");
-                jogo_t *game = get_current_game();
-                game_start_countdown(game);
-                set_game_state(STATE_SP_COUNTDOWN);
-              } else if (kb_result == 0) {
-                /* Character changed, redraw */
-                /* Redraw happens automatically */
-              }
-              
-              /* Always redraw for initials page */
-              uint16_t mouse_x = mouse_get_x();
-              uint16_t mouse_y = mouse_get_y();
-              draw_current_page(mouse_x, mouse_y);
-            }
-            else if (current_state == STATE_SP_COUNTDOWN && last_scancode == 0x1C) {
-              /* Enter pressed during countdown - skip to letter rain */
-              printf("Enter pressed, skipping countdown...\n");
-              jogo_t *game = get_current_game();
-              
-              int lr_init_result = game_start_letter_rain(game);
-              if (lr_init_result != 0) {
-                game->state = GAME_STATE_LETTER_RAIN;
-              }
-              
-              set_game_state(STATE_SP_LETTER_RAIN);
-              uint16_t mouse_x = mouse_get_x();
-              uint16_t mouse_y = mouse_get_y();
-              draw_current_page(mouse_x, mouse_y);
-            }
-            else if (current_state == STATE_SP_LETTER_RAIN) {
-              jogo_t *game = get_current_game();
-              
-              if (last_scancode == 0x1C) {
-                /* Enter pressed - skip letter rain */
-                printf("Enter pressed, skipping letter rain...\n");
-                
-                if (game->letra == 0) {
-                  game->letra = 'A';
-                  printf("Using default letter 'A'\n");
-                }
-                
-                set_game_state(STATE_SP_PLAYING);
-                uint16_t mouse_x = mouse_get_x();
-                uint16_t mouse_y = mouse_get_y();
-                draw_current_page(mouse_x, mouse_y);
-              } else {
-                /* Normal letter rain input */
-                game_handle_letter_rain_input(game, last_scancode);
-              }
-            }
-            else if (current_state == STATE_SP_PLAYING) {
-              extern singleplayer_game_t sp_game;
-              singleplayer_handle_input(&sp_game, last_scancode);
-              
-              /* Redraw happens automatically via timer */
-            }
+            states_key(last_scancode);
           }
           
           /* Mouse interrupt */
           if (msg.m_notify.interrupts & BIT(mouse_bit_no)) {
-            game_state_t current_state = get_game_state();
+            mouse_ih_custom();
             
-            /* Ignore mouse during active gameplay states */
-            if (current_state == STATE_SP_COUNTDOWN || current_state == STATE_SP_LETTER_RAIN || 
-                current_state == STATE_SP_PLAYING) {
-              mouse_ih_custom();
-              if (mouse_has_packet_ready()) {
-                mouse_clear_packet_ready();
-              }
-            } else {
-              /* Handle mouse normally */
-              mouse_ih_custom();
-              
-              if (mouse_has_packet_ready()) {
-                struct packet pp = mouse_get_packet();
-                mouse_clear_packet_ready();
-                
-                /* Redraw if mouse moved */
-                if (mouse_menu_needs_redraw() || mouse_should_redraw_page()) {
-                  uint16_t mouse_x = mouse_get_x();
-                  uint16_t mouse_y = mouse_get_y();
-                  draw_current_page(mouse_x, mouse_y);
-                  mouse_clear_redraw_flag();
-                  mouse_clear_page_redraw_flag();
-                }
-                
-                /* Handle left clicks */
-                if (pp.lb) {
-                  uint16_t mouse_x = mouse_get_x();
-                  uint16_t mouse_y = mouse_get_y();
-                  
-                  if (current_state == STATE_MAIN_MENU) {
-                    int click_result = handle_menu_click(mouse_x, mouse_y, true);
-                    if (click_result == 1) {
-                      /* Quit clicked */
-                      running = false;
-                    } else if (click_result == 0) {
-                      /* State changed */
-                      draw_current_page(mouse_x, mouse_y);
-                    }
-                  }
-                  else if (current_state == STATE_LEADERBOARD) {
-                    int click_result = handle_leaderboard_click(mouse_x, mouse_y, true);
-                    if (click_result == 1) {
-                      /* Back button clicked */
-                      set_game_state(STATE_MAIN_MENU);
-                      draw_current_page(mouse_x, mouse_y);
-                    }
-                  }
-                  else if (current_state == STATE_INSTRUCTIONS) {
-                    int click_result = handle_instructions_click(mouse_x, mouse_y, true);
-                    if (click_result == 1) {
-                      /* Back button clicked */
-                      set_game_state(STATE_MAIN_MENU);
-                      draw_current_page(mouse_x, mouse_y);
-                    }
-                  }
-                  else if (current_state == STATE_SP_ENTER_INITIALS) {
-                    int click_result = handle_initials_click(mouse_x, mouse_y, true);
-                    if (click_result == 1) {
-                      /* Done button clicked */
-                      jogo_t *game = get_current_game();
-                      if (game_validate_initials(game)) {
-                        game_start_countdown(game);
-                        set_game_state(STATE_SP_COUNTDOWN);
-                        draw_current_page(mouse_x, mouse_y);
-                      }
-                    }
-                  }
-                }
-              }
+            if (mouse_has_packet_ready()) {
+              struct packet pp = mouse_get_packet();
+              mouse_clear_packet_ready();
+              states_mouse(&pp);
             }
           }
           break;
@@ -458,10 +234,29 @@ int (proj_main_loop)(int argc, char* argv[])
     }
   }
   
-cleanup_and_exit:
+  states_print_stats();
+  rel_print_stats();
+  if (trace_on) {
+    trace_stop();
+    if (trace_save("/home/lcom/labs/grupo_2leic10_2/proj/src/" TRACE_FILE) != 0 && trace_save(TRACE_FILE) != 0) {
+      printf("Error saving the protocol trace\n");
+    }
+  }
+  
   printf("=== Cleaning up and exiting ===\n");
   
+  /* Leave timer 0 at the rate LCF expects */
+  states_restore_tick_rate();
+  
+  /* Close the serial link if we quit during a multiplayer session */
+  serial_cleanup();
+  
+  dictionary_unload();
+  
   /* Unsubscribe interrupts - ONLY ONCE at the end */
+  printf("Unsubscribing serial port interrupts...\n");
+  serial_unsubscribe_int();
+  
   printf("Unsubscribing timer interrupts...\n");
   timer_unsubscribe_int();
   
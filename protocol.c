@@ -0,0 +1,219 @@
+#include "protocol.h"
+#include "serial.h"
+#include "trace.h"
+#include <string.h>
+
+/* Payload limits per message type: the decoder rejects anything else */
+static const struct {
+  const char *name;
+  uint8_t min_length;
+  uint8_t max_length;
+  bool reliable;
+} msg_types[MSG_TYPE_COUNT] = {
+  [MSG_NONE]          = {"NONE",          0, 0, false},
+  [MSG_ACK]           = {"ACK",           MSG_ACK_SIZE, MSG_ACK_SIZE, false},
+  [MSG_CONNECT]       = {"CONNECT",       MSG_CONNECT_SIZE, MSG_CONNECT_SIZE, true},
+  [MSG_GAME_FINISHED] = {"GAME_FINISHED", MSG_GAME_FINISHED_SIZE, MSG_GAME_FINISHED_SIZE, true},
+  [MSG_PROGRESS]      = {"PROGRESS",      MSG_PROGRESS_SIZE, MSG_PROGRESS_SIZE, false},
+  [MSG_TIME_REQUEST]  = {"TIME_REQUEST",  MSG_TIME_REQUEST_SIZE, MSG_TIME_REQUEST_SIZE, false},
+  [MSG_TIME_RESPONSE] = {"TIME_RESPONSE", MSG_TIME_RESPONSE_SIZE, MSG_TIME_RESPONSE_SIZE, false},
+  [MSG_READY]         = {"READY",         MSG_READY_SIZE, MSG_READY_SIZE, true},
+};
+
+/* CRC-16/CCITT, polynomial 0x1021, one entry per byte value */
+static const uint16_t crc_table[256] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+  0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+  0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+  0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+  0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+  0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+  0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+  0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+  0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+  0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+  0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+  0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+  0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+  0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+  0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+  0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+  0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+  0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+  0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+  0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+  0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+  0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+  0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+  0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+  0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+  0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+  0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+  0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+  0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+  0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+  0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+static proto_stats_t stats;
+
+uint16_t proto_crc16(uint16_t crc, const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    crc = (uint16_t) ((crc << 8) ^ crc_table[(crc >> 8) ^ data[i]]);
+  }
+  return crc;
+}
+
+void proto_put_u32(uint8_t *dst, uint32_t value) {
+  dst[0] = (uint8_t) value;
+  dst[1] = (uint8_t) (value >> 8);
+  dst[2] = (uint8_t) (value >> 16);
+  dst[3] = (uint8_t) (value >> 24);
+}
+
+uint32_t proto_get_u32(const uint8_t *src) {
+  return (uint32_t) src[0] | (uint32_t) src[1] << 8 | (uint32_t) src[2] << 16 | (uint32_t) src[3] << 24;
+}
+
+void proto_put_u64(uint8_t *dst, uint64_t value) {
+  proto_put_u32(dst, (uint32_t) value);
+  proto_put_u32(dst + 4, (uint32_t) (value >> 32));
+}
+
+uint64_t proto_get_u64(const uint8_t *src) {
+  return (uint64_t) proto_get_u32(src) | (uint64_t) proto_get_u32(src + 4) << 32;
+}
+
+const char *proto_type_name(uint8_t type) {
+  return type < MSG_TYPE_COUNT ? msg_types[type].name : "?";
+}
+
+bool proto_type_reliable(uint8_t type) {
+  return type < MSG_TYPE_COUNT && msg_types[type].reliable;
+}
+
+const proto_stats_t *proto_stats() {
+  return &stats;
+}
+
+/* Copy bytes into ring spans starting at offset, returning the new offset */
+static size_t spans_write(serial_span_t spans[2], size_t offset, const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++, offset++) {
+    if (offset < spans[0].len) spans[0].data[offset] = data[i];
+    else spans[1].data[offset - spans[0].len] = data[i];
+  }
+  return offset;
+}
+
+/* Byte of the ring spans at offset */
+static uint8_t spans_at(const serial_span_t spans[2], size_t offset) {
+  return offset < spans[0].len ? spans[0].data[offset] : spans[1].data[offset - spans[0].len];
+}
+
+/* CRC of len bytes of the ring spans from offset, without linearizing them */
+static uint16_t spans_crc(const serial_span_t spans[2], size_t offset, size_t len) {
+  uint16_t crc = 0xFFFF;
+  if (offset < spans[0].len) {
+    size_t first = spans[0].len - offset < len ? spans[0].len - offset : len;
+    crc = proto_crc16(crc, spans[0].data + offset, first);
+    offset += first;
+    len -= first;
+  }
+  return proto_crc16(crc, spans[1].data + (offset - spans[0].len), len);
+}
+
+int proto_send(msg_type_t type, uint16_t session, uint8_t seq, const void *payload, uint8_t length) {
+  if (length > PROTO_MAX_PAYLOAD) return 1;
+
+  size_t size = PROTO_HEADER_SIZE + length + PROTO_CRC_SIZE;
+  serial_span_t spans[2];
+  if (serial_tx_reserve(size, spans) != 0) return 1;
+
+  uint8_t header[PROTO_HEADER_SIZE] = {PROTO_SYNC, length, (uint8_t) type, (uint8_t) session,
+                                       (uint8_t) (session >> 8), seq};
+  size_t offset = spans_write(spans, 0, header, sizeof(header));
+  offset = spans_write(spans, offset, payload, length);
+
+  uint16_t crc = spans_crc(spans, 1, offset - 1);
+  uint8_t trailer[PROTO_CRC_SIZE] = {(uint8_t) crc, (uint8_t) (crc >> 8)};
+  spans_write(spans, offset, trailer, sizeof(trailer));
+
+  stats.frames_sent++;
+  stats.bytes_sent += (uint32_t) size;
+  TRACE(TRACE_TX, type, seq, length, session, 0);
+  return serial_tx_commit(size);
+}
+
+int proto_receive(const proto_handler_t handlers[MSG_TYPE_COUNT]) {
+  int handled = 0;
+  serial_span_t spans[2];
+  size_t available;
+
+  while ((available = serial_rx_data(spans)) > 0) {
+    /* Skip to the next sync byte (the first span is never empty) */
+    if (spans[0].data[0] != PROTO_SYNC) {
+      const uint8_t *sync = memchr(spans[0].data, PROTO_SYNC, spans[0].len);
+      size_t skip = sync != NULL ? (size_t) (sync - spans[0].data) : spans[0].len;
+      stats.skipped_bytes += (uint32_t) skip;
+      TRACE(TRACE_RX_SKIPPED, 0, 0, 0, 0, (uint32_t) skip);
+      serial_rx_consume(skip);
+      continue;
+    }
+
+    if (available < PROTO_HEADER_SIZE) break;
+    uint8_t length = spans_at(spans, 1);
+    if (length > PROTO_MAX_PAYLOAD) {
+      stats.skipped_bytes++;
+      serial_rx_consume(1);
+      continue;
+    }
+
+    size_t size = PROTO_HEADER_SIZE + length + PROTO_CRC_SIZE;
+    if (available < size) break; /* Rest of the frame not here yet */
+
+    size_t end = PROTO_HEADER_SIZE + length;
+    uint16_t crc = (uint16_t) (spans_at(spans, end) | spans_at(spans, end + 1) << 8);
+    if (spans_crc(spans, 1, end - 1) != crc) {
+      stats.crc_errors++;
+      TRACE(TRACE_RX_CRC, spans_at(spans, 2), spans_at(spans, 5), length, 0, crc);
+      stats.skipped_bytes++;
+      serial_rx_consume(1); /* A false sync or a damaged frame: look again one byte later */
+      continue;
+    }
+
+    proto_frame_t frame = {
+      .type = spans_at(spans, 2),
+      .seq = spans_at(spans, 5),
+      .session = (uint16_t) (spans_at(spans, 3) | spans_at(spans, 4) << 8),
+      .length = length,
+    };
+    if (frame.type >= MSG_TYPE_COUNT || frame.type == MSG_NONE ||
+        length < msg_types[frame.type].min_length || length > msg_types[frame.type].max_length) {
+      stats.bad_frames++;
+      TRACE(TRACE_RX_BAD, frame.type, frame.seq, length, frame.session, 0);
+      serial_rx_consume(size);
+      continue;
+    }
+
+    /* Payload used in place, copied only when it wraps around the ring */
+    uint8_t scratch[PROTO_MAX_PAYLOAD];
+    if (end <= spans[0].len) {
+      frame.payload = spans[0].data + PROTO_HEADER_SIZE;
+    } else if (PROTO_HEADER_SIZE >= spans[0].len) {
+      frame.payload = spans[1].data + (PROTO_HEADER_SIZE - spans[0].len);
+    } else {
+      for (uint8_t i = 0; i < length; i++) scratch[i] = spans_at(spans, PROTO_HEADER_SIZE + i);
+      frame.payload = scratch;
+    }
+
+    stats.frames_received++;
+    stats.bytes_received += (uint32_t) size;
+    TRACE(TRACE_RX, frame.type, frame.seq, length, frame.session, 0);
+    if (handlers[frame.type] != NULL) handlers[frame.type](&frame);
+    serial_rx_consume(size);
+    handled++;
+  }
+
+  return handled;
+}
@@ -0,0 +1,165 @@
+#ifndef _PROTOCOL_H_
+#define _PROTOCOL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Multiplayer frames on the serial link (all integers little-endian):
+ *
+ *   sync  length  type  session(2)  seq  payload[length]  crc(2)
+ *
+ * The CRC-16 (CCITT, initial value 0xFFFF) covers length through payload.
+ * A receiver that loses track skips bytes until the next sync byte that
+ * starts a frame with a valid CRC. seq numbers the reliable messages of a
+ * session (see reliable.h), other frames send 0.
+ */
+
+#define PROTO_SYNC 0xA5
+#define PROTO_HEADER_SIZE 6   /* sync, length, type, session, seq */
+#define PROTO_CRC_SIZE 2
+#define PROTO_MAX_PAYLOAD 32
+#define PROTO_MAX_FRAME (PROTO_HEADER_SIZE + PROTO_MAX_PAYLOAD + PROTO_CRC_SIZE)
+
+/**
+ * @brief Message types
+ */
+typedef enum {
+  MSG_NONE,           /* Never sent */
+  MSG_ACK,            /* next expected seq (uint8) */
+  MSG_CONNECT,        /* Reliable: nonce (uint32), seed (uint64) of a player on the connection screen */
+  MSG_GAME_FINISHED,  /* Reliable: initials[3], score (int32) */
+  MSG_PROGRESS,       /* initials[3], score (int32), words (uint8), remaining seconds (uint8) */
+  MSG_TIME_REQUEST,   /* Clock sample: send time (uint64) */
+  MSG_TIME_RESPONSE,  /* Request send time, receive time, response send time (uint64 each) */
+  MSG_READY,          /* Reliable: phase (uint8), time the player got ready on the host clock (uint64) */
+  MSG_TYPE_COUNT
+} msg_type_t;
+
+#define MSG_ACK_SIZE 1
+#define MSG_CONNECT_SIZE 12
+#define MSG_GAME_FINISHED_SIZE 7
+#define MSG_PROGRESS_SIZE 9
+#define MSG_TIME_REQUEST_SIZE 8
+#define MSG_TIME_RESPONSE_SIZE 24
+#define MSG_READY_SIZE 9
+
+/**
+ * @brief Received frame, valid only while its handler runs
+ */
+typedef struct {
+  uint8_t type;
+  uint8_t seq;
+  uint16_t session;        /* Session of the sender */
+  uint8_t length;
+  const uint8_t *payload;  /* In the RX ring whenever it is contiguous there */
+} proto_frame_t;
+
+/**
+ * @brief Handler of one message type
+ */
+typedef void (*proto_handler_t)(const proto_frame_t *frame);
+
+/**
+ * @brief Protocol counters
+ */
+typedef struct {
+  uint32_t frames_sent;
+  uint32_t bytes_sent;
+  uint32_t frames_received;
+  uint32_t bytes_received;  /* Bytes of valid frames */
+  uint32_t skipped_bytes;   /* Bytes discarded while looking for a frame */
+  uint32_t crc_errors;
+  uint32_t bad_frames;      /* Valid CRC but unknown type or wrong length */
+} proto_stats_t;
+
+/**
+ * @brief Encode a frame straight into the serial TX ring and start sending it
+ *
+ * @param type Message type
+ * @param session Session of the sender
+ * @param seq Sequence number
+ * @param payload Payload bytes (NULL if length is 0)
+ * @param length Payload size, up to PROTO_MAX_PAYLOAD
+ * @return 0 on success, 1 on error
+ */
+int proto_send(msg_type_t type, uint16_t session, uint8_t seq, const void *payload, uint8_t length);
+
+/**
+ * @brief Decode every complete frame in the serial RX ring
+ *
+ * Each frame is checked and handed to handlers[type] (NULL handlers ignore
+ * the type); incomplete frames stay in the ring for the next call.
+ *
+ * @param handlers Handler per message type
+ * @return Number of frames handled
+ */
+int proto_receive(const proto_handler_t handlers[MSG_TYPE_COUNT]);
+
+/**
+ * @brief Name of a message type, for logs
+ *
+ * @param type Message type
+ * @return Name ("?" for unknown types)
+ */
+const char *proto_type_name(uint8_t type);
+
+/**
+ * @brief Check if a message type is delivered reliably
+ *
+ * @param type Message type
+ * @return true if it is sequenced, acknowledged and retransmitted
+ */
+bool proto_type_reliable(uint8_t type);
+
+/**
+ * @brief Update a CRC-16 (CCITT) with more bytes
+ *
+ * @param crc CRC so far (0xFFFF to start)
+ * @param data Bytes
+ * @param len Number of bytes
+ * @return Updated CRC
+ */
+uint16_t proto_crc16(uint16_t crc, const uint8_t *data, size_t len);
+
+/**
+ * @brief Store a 32-bit integer in a payload (little-endian)
+ *
+ * @param dst Payload position
+ * @param value Value
+ */
+void proto_put_u32(uint8_t *dst, uint32_t value);
+
+/**
+ * @brief Load a 32-bit integer from a payload (little-endian)
+ *
+ * @param src Payload position
+ * @return Value
+ */
+uint32_t proto_get_u32(const uint8_t *src);
+
+/**
+ * @brief Store a 64-bit integer in a payload (little-endian)
+ *
+ * @param dst Payload position
+ * @param value Value
+ */
+void proto_put_u64(uint8_t *dst, uint64_t value);
+
+/**
+ * @brief Load a 64-bit integer from a payload (little-endian)
+ *
+ * @param src Payload position
+ * @return Value
+ */
+uint64_t proto_get_u64(const uint8_t *src);
+
+/**
+ * @brief Get the protocol counters
+ *
+ * @return Counters since the program started
+ */
+const proto_stats_t *proto_stats();
+
+#endif /* _PROTOCOL_H_ */
@@ -0,0 +1,211 @@
+#include "reliable.h"
+#include "trace.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Reliable message waiting for its acknowledgement */
+typedef struct {
+  uint8_t type;
+  uint8_t length;
+  uint8_t payload[PROTO_MAX_PAYLOAD];
+  uint64_t first_sent_ns;
+  uint64_t last_sent_ns;
+  bool retransmitted;    /* No round trip sample from it (Karn) */
+} rel_slot_t;
+
+static uint16_t own_session = 0;
+static bool peer_known = false;
+static uint16_t peer_session = 0;
+
+/* Send window: seqs [send_base, send_next), slot of seq is seq % REL_WINDOW */
+static rel_slot_t window[REL_WINDOW];
+static uint8_t send_base = 0, send_next = 0;
+static uint8_t recv_next = 0; /* Next seq expected from the peer */
+
+static uint64_t rttvar_ns = 0;
+static rel_stats_t stats;
+
+/* rel_receive arguments, for the frame callback */
+static const proto_handler_t *user_handlers = NULL;
+static uint64_t receive_now_ns = 0;
+
+void rel_reset(uint16_t session) {
+  own_session = session;
+  peer_known = false;
+  send_base = send_next = 0;
+  recv_next = 0;
+  stats.srtt_ns = 0;
+  rttvar_ns = 0;
+  stats.rto_ns = REL_INITIAL_RTO_NS;
+}
+
+static void transmit(uint8_t seq, uint64_t now_ns) {
+  rel_slot_t *slot = &window[seq % REL_WINDOW];
+  slot->last_sent_ns = now_ns;
+  proto_send(slot->type, own_session, seq, slot->payload, slot->length);
+}
+
+int rel_send(msg_type_t type, const void *payload, uint8_t length, uint64_t now_ns) {
+  if ((uint8_t) (send_next - send_base) >= REL_WINDOW || length > PROTO_MAX_PAYLOAD) return 1;
+
+  rel_slot_t *slot = &window[send_next % REL_WINDOW];
+  slot->type = (uint8_t) type;
+  slot->length = length;
+  if (length > 0) memcpy(slot->payload, payload, length);
+  slot->first_sent_ns = now_ns;
+  slot->retransmitted = false;
+
+  stats.sent++;
+  transmit(send_next++, now_ns);
+  return 0;
+}
+
+/* Go back N: everything unacknowledged again, in order, with a doubled timeout */
+static void retransmit_all(uint64_t now_ns) {
+  for (uint8_t seq = send_base; seq != send_next; seq++) {
+    window[seq % REL_WINDOW].retransmitted = true;
+    TRACE(TRACE_RETRANSMIT, window[seq % REL_WINDOW].type, seq, window[seq % REL_WINDOW].length, own_session,
+          stats.rto_ns / 1000);
+    transmit(seq, now_ns);
+    stats.retransmits++;
+  }
+}
+
+void rel_tick(uint64_t now_ns) {
+  if (send_base == send_next) return;
+  if (now_ns - window[send_base % REL_WINDOW].last_sent_ns < stats.rto_ns) return;
+
+  retransmit_all(now_ns);
+  stats.rto_ns = stats.rto_ns * 2 > REL_MAX_RTO_NS ? REL_MAX_RTO_NS : stats.rto_ns * 2;
+}
+
+/* RFC 6298 smoothing, in integer nanoseconds */
+static void rtt_sample(uint64_t rtt_ns) {
+  if (stats.srtt_ns == 0) {
+    stats.srtt_ns = rtt_ns;
+    rttvar_ns = rtt_ns / 2;
+  } else {
+    uint64_t error = stats.srtt_ns > rtt_ns ? stats.srtt_ns - rtt_ns : rtt_ns - stats.srtt_ns;
+    rttvar_ns = (3 * rttvar_ns + error) / 4;
+    stats.srtt_ns = (7 * stats.srtt_ns + rtt_ns) / 8;
+  }
+}
+
+static void handle_ack(uint8_t next_expected, uint64_t now_ns) {
+  uint8_t acked = (uint8_t) (next_expected - send_base);
+  if (acked == 0 || acked > (uint8_t) (send_next - send_base)) return; /* Old or bogus */
+
+  for (; send_base != next_expected; send_base++) {
+    rel_slot_t *slot = &window[send_base % REL_WINDOW];
+    uint64_t latency = now_ns - slot->first_sent_ns;
+    if (!slot->retransmitted) rtt_sample(latency);
+    stats.latency_sum_ns += latency;
+    TRACE(TRACE_DELIVERED, slot->type, send_base, slot->length, own_session, (uint32_t) (latency / 1000));
+    if (latency > stats.latency_max_ns) stats.latency_max_ns = latency;
+    stats.delivered++;
+  }
+
+  uint64_t rto = stats.srtt_ns + 4 * rttvar_ns;
+  stats.rto_ns = rto < REL_MIN_RTO_NS ? REL_MIN_RTO_NS : rto > REL_MAX_RTO_NS ? REL_MAX_RTO_NS : rto;
+}
+
+static void send_ack() {
+  stats.acks_sent++;
+  proto_send(MSG_ACK, own_session, 0, &recv_next, MSG_ACK_SIZE);
+}
+
+static void on_frame(const proto_frame_t *frame) {
+  if (frame->session == own_session) {
+    stats.loopback++;
+    TRACE(TRACE_LOOPBACK, frame->type, frame->seq, frame->length, frame->session, 0);
+    return;
+  }
+
+  /* A peer starts its session with seq 0; our unacknowledged messages go out
+   * again right away since it may have discarded them while starting */
+  if (proto_type_reliable(frame->type) && frame->seq == 0 &&
+      (!peer_known || frame->session != peer_session)) {
+    peer_known = true;
+    peer_session = frame->session;
+    TRACE(TRACE_PEER, frame->type, frame->seq, frame->length, frame->session, 0);
+    recv_next = 0;
+    if (send_base != send_next) retransmit_all(receive_now_ns);
+  }
+  if (!peer_known || frame->session != peer_session) return; /* Stale frame of another session */
+
+  if (frame->type == MSG_ACK) {
+    stats.acks_received++;
+    handle_ack(frame->payload[0], receive_now_ns);
+    return;
+  }
+
+  if (proto_type_reliable(frame->type)) {
+    uint8_t ahead = (uint8_t) (frame->seq - recv_next);
+    if (ahead != 0) {
+      if (ahead < 128) {
+        stats.out_of_order++;
+        TRACE(TRACE_OUT_OF_ORDER, frame->type, frame->seq, frame->length, frame->session, recv_next);
+      } else {
+        stats.duplicates++;
+        TRACE(TRACE_DUPLICATE, frame->type, frame->seq, frame->length, frame->session, recv_next);
+      }
+      send_ack(); /* The peer's ACK may have been lost */
+      return;
+    }
+    recv_next++;
+    stats.received++;
+    send_ack();
+  }
+
+  if (user_handlers[frame->type] != NULL) user_handlers[frame->type](frame);
+}
+
+int rel_receive(const proto_handler_t handlers[MSG_TYPE_COUNT], uint64_t now_ns) {
+  static const proto_handler_t dispatch[MSG_TYPE_COUNT] = {
+    [MSG_ACK] = on_frame,
+    [MSG_CONNECT] = on_frame,
+    [MSG_GAME_FINISHED] = on_frame,
+    [MSG_PROGRESS] = on_frame,
+    [MSG_TIME_REQUEST] = on_frame,
+    [MSG_TIME_RESPONSE] = on_frame,
+    [MSG_READY] = on_frame,
+  };
+
+  /* Reliable messages are acknowledged as they arrive, so a table missing one would
+   * lose it for good: refuse such tables (checked once per table) */
+  static const proto_handler_t *checked = NULL;
+  if (handlers != checked) {
+    for (int type = 0; type < MSG_TYPE_COUNT; type++) {
+      if (proto_type_reliable((uint8_t) type) && handlers[type] == NULL) {
+        printf("rel_receive(): no handler for reliable %s messages\n", proto_type_name((uint8_t) type));
+        return -1;
+      }
+    }
+    checked = handlers;
+  }
+
+  user_handlers = handlers;
+  receive_now_ns = now_ns;
+  return proto_receive(dispatch);
+}
+
+bool rel_all_delivered() {
+  return send_base == send_next;
+}
+
+const rel_stats_t *rel_stats() {
+  return &stats;
+}
+
+void rel_print_stats() {
+  if (stats.sent == 0 && stats.received == 0) return;
+
+  printf("Reliable link: %u sent, %u delivered, %u retransmits, %u received, %u duplicates, "
+         "%u out of order, %u loopback\n",
+         stats.sent, stats.delivered, stats.retransmits, stats.received, stats.duplicates,
+         stats.out_of_order, stats.loopback);
+  printf("Reliable link: delivery latency avg %llu us, max %llu us, srtt %llu us, rto %llu ms\n",
+         stats.delivered > 0 ? (unsigned long long) (stats.latency_sum_ns / stats.delivered / 1000) : 0ULL,
+         (unsigned long long) (stats.latency_max_ns / 1000), (unsigned long long) (stats.srtt_ns / 1000),
+         (unsigned long long) (stats.rto_ns / 1000000));
+}
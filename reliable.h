@@ -0,0 +1,99 @@
+#ifndef _RELIABLE_H_
+#define _RELIABLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "protocol.h"
+
+/*
+ * Reliable messages over the framed link. Each reliable message gets the
+ * next sequence number of the session and stays in a send window until the
+ * peer acknowledges it. ACKs are cumulative: they carry the next sequence
+ * number the receiver expects. Unacknowledged messages are sent again after
+ * a retransmit timeout derived from the measured round trip time (RFC 6298
+ * smoothing, doubled on every timeout). Duplicates and messages received
+ * ahead of a missing one are dropped and acknowledged again.
+ *
+ * Time is passed in by the caller, in nanoseconds.
+ */
+
+#define REL_WINDOW 8                             /* Reliable messages in flight */
+#define REL_INITIAL_RTO_NS (250 * 1000000ULL)    /* Before the first round trip is measured */
+#define REL_MIN_RTO_NS (20 * 1000000ULL)
+#define REL_MAX_RTO_NS (1000 * 1000000ULL)
+
+/**
+ * @brief Reliable delivery counters
+ */
+typedef struct {
+  uint32_t sent;           /* Reliable messages queued */
+  uint32_t delivered;      /* Reliable messages acknowledged */
+  uint32_t retransmits;    /* Frames sent again after a timeout */
+  uint32_t received;       /* Reliable messages handed to the game */
+  uint32_t duplicates;     /* Received again and dropped */
+  uint32_t out_of_order;   /* Received after a gap and dropped */
+  uint32_t loopback;       /* Own frames received back */
+  uint32_t acks_sent;
+  uint32_t acks_received;
+  uint64_t latency_sum_ns; /* First transmission to acknowledgement */
+  uint64_t latency_max_ns;
+  uint64_t srtt_ns;        /* Smoothed round trip time */
+  uint64_t rto_ns;         /* Current retransmit timeout */
+} rel_stats_t;
+
+/**
+ * @brief Start a session: empty window, sequence numbers from 0, peer unknown
+ *
+ * @param session Our session id, sent in every frame
+ */
+void rel_reset(uint16_t session);
+
+/**
+ * @brief Send a reliable message
+ *
+ * @param type Reliable message type
+ * @param payload Payload bytes (NULL if length is 0)
+ * @param length Payload size
+ * @param now_ns Current time
+ * @return 0 on success, 1 if the send window is full
+ */
+int rel_send(msg_type_t type, const void *payload, uint8_t length, uint64_t now_ns);
+
+/**
+ * @brief Retransmit what timed out
+ *
+ * @param now_ns Current time
+ */
+void rel_tick(uint64_t now_ns);
+
+/**
+ * @brief Decode received frames: ACKs update the window, reliable messages are
+ * acknowledged, deduplicated and then handed to handlers[type] like every other frame
+ *
+ * @param handlers Handler per message type (NULL ignores the type); every reliable type
+ * must have one, since it is acknowledged before being handed over
+ * @param now_ns Current time
+ * @return Number of frames decoded, -1 if a reliable type has no handler
+ */
+int rel_receive(const proto_handler_t handlers[MSG_TYPE_COUNT], uint64_t now_ns);
+
+/**
+ * @brief Check if every reliable message sent was acknowledged
+ *
+ * @return true if the send window is empty
+ */
+bool rel_all_delivered();
+
+/**
+ * @brief Get the reliable delivery counters
+ *
+ * @return Counters since the program started (srtt_ns and rto_ns of the current session)
+ */
+const rel_stats_t *rel_stats();
+
+/**
+ * @brief Print the reliable delivery counters
+ */
+void rel_print_stats();
+
+#endif /* _RELIABLE_H_ */
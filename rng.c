@@ -0,0 +1,114 @@
+#include "rng.h"
+#include <stdio.h>
+
+#define PCG_MULTIPLIER 6364136223846793005ULL
+
+static uint64_t game_seed = 0;
+static uint32_t stream_uses[RNG_STREAM_COUNT];
+
+/* SplitMix64 finalizer, spreads nearby seeds over the whole state space */
+static uint64_t mix64(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+void rng_init(uint64_t seed) {
+  game_seed = seed;
+  for (int i = 0; i < RNG_STREAM_COUNT; i++) stream_uses[i] = 0;
+  printf("rng_init(): game seed %llu\n", (unsigned long long) seed);
+}
+
+uint64_t rng_game_seed() {
+  return game_seed;
+}
+
+void rng_stream(rng_t *rng, rng_stream_t stream) {
+  uint64_t use = stream_uses[stream]++;
+  rng_seed(rng, mix64(game_seed ^ mix64(use)), (uint64_t) stream);
+}
+
+void rng_seed(rng_t *rng, uint64_t seed, uint64_t sequence) {
+  rng->state = 0;
+  rng->inc = (sequence << 1) | 1;
+  rng_next(rng);
+  rng->state += seed;
+  rng_next(rng);
+}
+
+uint32_t rng_next(rng_t *rng) {
+  uint64_t old = rng->state;
+  rng->state = old * PCG_MULTIPLIER + rng->inc;
+  uint32_t xorshifted = (uint32_t) (((old >> 18) ^ old) >> 27);
+  uint32_t rot = (uint32_t) (old >> 59);
+  return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+uint32_t rng_range(rng_t *rng, uint32_t bound) {
+  if (bound == 0) return 0;
+
+  /* Lemire: high half of a 32x32 product, retrying the few biased low halves */
+  uint64_t m = (uint64_t) rng_next(rng) * bound;
+  uint32_t low = (uint32_t) m;
+  if (low < bound) {
+    uint32_t threshold = -bound % bound;
+    while (low < threshold) {
+      m = (uint64_t) rng_next(rng) * bound;
+      low = (uint32_t) m;
+    }
+  }
+  return (uint32_t) (m >> 32);
+}
+
+int alias_build(alias_table_t *table, const uint32_t *weights, int count) {
+  if (count < 1 || count > ALIAS_MAX) return 1;
+
+  uint64_t total = 0;
+  for (int i = 0; i < count; i++) total += weights[i];
+  if (total == 0) return 1;
+
+  /* Vose: scaled weights, a column is full at exactly total */
+  uint64_t scaled[ALIAS_MAX];
+  int small[ALIAS_MAX], large[ALIAS_MAX];
+  int small_count = 0, large_count = 0;
+  for (int i = 0; i < count; i++) {
+    scaled[i] = (uint64_t) weights[i] * count;
+    if (scaled[i] < total) small[small_count++] = i;
+    else large[large_count++] = i;
+  }
+
+  while (small_count > 0 && large_count > 0) {
+    int s = small[--small_count];
+    int l = large[large_count - 1];
+    table->threshold[s] = (uint32_t) ((scaled[s] << 32) / total);
+    table->alias[s] = (uint8_t) l;
+
+    /* The large outcome fills the rest of the small column */
+    scaled[l] -= total - scaled[s];
+    if (scaled[l] < total) {
+      large_count--;
+      small[small_count++] = l;
+    }
+  }
+
+  /* Full columns (and rounding leftovers) always keep their own outcome */
+  while (large_count > 0) {
+    int l = large[--large_count];
+    table->threshold[l] = UINT32_MAX;
+    table->alias[l] = (uint8_t) l;
+  }
+  while (small_count > 0) {
+    int s = small[--small_count];
+    table->threshold[s] = UINT32_MAX;
+    table->alias[s] = (uint8_t) s;
+  }
+
+  table->count = count;
+  return 0;
+}
+
+int alias_sample(const alias_table_t *table, rng_t *rng) {
+  int column = (int) rng_range(rng, (uint32_t) table->count);
+  return rng_next(rng) < table->threshold[column] ? column : table->alias[column];
+}
@@ -0,0 +1,106 @@
+#ifndef _RNG_H_
+#define _RNG_H_
+
+#include <stdint.h>
+
+#define ALIAS_MAX 32 /* Most outcomes an alias table can hold */
+
+/**
+ * @brief Independent random streams derived from the game seed
+ */
+typedef enum {
+  RNG_STREAM_LETTERS,   /* Letters spawned by letter rain */
+  RNG_STREAM_SPAWN_X,   /* Spawn positions of letter rain */
+  RNG_STREAM_CATEGORY,  /* Singleplayer category choice */
+  RNG_STREAM_SESSION,   /* Multiplayer session ids */
+  RNG_STREAM_COUNT
+} rng_stream_t;
+
+/**
+ * @brief PCG32 generator (XSH-RR output on a 64-bit LCG), one per stream
+ */
+typedef struct {
+  uint64_t state;
+  uint64_t inc; /* Odd LCG increment, selects the stream */
+} rng_t;
+
+/**
+ * @brief Walker alias table, samples a weighted outcome in constant time
+ */
+typedef struct {
+  int count;
+  uint32_t threshold[ALIAS_MAX]; /* Keep the column if next random < threshold */
+  uint8_t alias[ALIAS_MAX];      /* Outcome used otherwise */
+} alias_table_t;
+
+/**
+ * @brief Set the game seed every stream is derived from
+ *
+ * @param seed Seed (the same seed replays the same games)
+ */
+void rng_init(uint64_t seed);
+
+/**
+ * @brief Get the game seed
+ *
+ * @return Seed given to rng_init
+ */
+uint64_t rng_game_seed();
+
+/**
+ * @brief Seed a generator for a stream
+ *
+ * Each call for the same stream gives the next sequence, so successive rounds
+ * differ but the whole session is reproducible from the game seed.
+ *
+ * @param rng Generator
+ * @param stream Stream it is used for
+ */
+void rng_stream(rng_t *rng, rng_stream_t stream);
+
+/**
+ * @brief Seed a generator directly
+ *
+ * @param rng Generator
+ * @param seed Initial state
+ * @param sequence Stream selector
+ */
+void rng_seed(rng_t *rng, uint64_t seed, uint64_t sequence);
+
+/**
+ * @brief Get the next random number
+ *
+ * @param rng Generator
+ * @return Uniform 32-bit value
+ */
+uint32_t rng_next(rng_t *rng);
+
+/**
+ * @brief Get a uniform number below a bound, without modulo bias
+ *
+ * @param rng Generator
+ * @param bound Exclusive upper bound (0 returns 0)
+ * @return Value in [0, bound)
+ */
+uint32_t rng_range(rng_t *rng, uint32_t bound);
+
+/**
+ * @brief Build an alias table from integer weights
+ *
+ * @param table Table
+ * @param weights Weight of each outcome
+ * @param count Number of outcomes (1 to ALIAS_MAX)
+ * @return 0 on success, 1 if count is out of range or all weights are 0
+ */
+int alias_build(alias_table_t *table, const uint32_t *weights, int count);
+
+/**
+ * @brief Sample an outcome with probability proportional to its weight
+ *
+ * @param table Table built by alias_build
+ * @param rng Generator
+ * @return Outcome index
+ */
+int alias_sample(const alias_table_t *table, rng_t *rng);
+
+#endif /* _RNG_H_ */
@@ -1,118 +1,179 @@
 #include "serial.h"
-#include <lcom/lcf.h>
+#include "serial_port.h"
 #include <stdio.h>
-#include <fcntl.h>
-#include <unistd.h>
 #include <string.h>
-#include <errno.h>
 
-static int serial_fd = -1;
+static bool serial_open = false;
+
+/* Rings indexed by free-running counters: used = head - tail.
+ * The device fills rx_ring and drains tx_ring, the game does the opposite */
+static uint8_t rx_ring[SERIAL_RX_SIZE];
+static uint32_t rx_head = 0, rx_tail = 0;
+static uint8_t tx_ring[SERIAL_TX_SIZE];
+static uint32_t tx_head = 0, tx_tail = 0;
+
+static serial_stats_t stats;
+
+/* Part of a ring as at most two contiguous pieces */
+static size_t ring_spans(uint8_t *ring, uint32_t size, uint32_t from, uint32_t len, serial_span_t spans[2]) {
+    uint32_t start = from & (size - 1);
+    uint32_t first = size - start < len ? size - start : len;
+    
+    spans[0].data = ring + start;
+    spans[0].len = first;
+    spans[1].data = ring;
+    spans[1].len = len - first;
+    return len;
+}
+
+size_t serial_rx_space(serial_span_t spans[2]) {
+    return ring_spans(rx_ring, SERIAL_RX_SIZE, rx_head, SERIAL_RX_SIZE - (rx_head - rx_tail), spans);
+}
+
+void serial_rx_commit(size_t len) {
+    rx_head += (uint32_t)len;
+    stats.rx_bytes += (uint32_t)len;
+}
+
+size_t serial_tx_pending(serial_span_t spans[2]) {
+    return ring_spans(tx_ring, SERIAL_TX_SIZE, tx_tail, tx_head - tx_tail, spans);
+}
+
+void serial_tx_consume(size_t len) {
+    tx_tail += (uint32_t)len;
+    stats.tx_bytes += (uint32_t)len;
+}
+
+serial_stats_t *serial_port_stats() {
+    return &stats;
+}
 
 int serial_init() {
-    /* Try to open serial port device */
-    serial_fd = open("/dev/tty00", O_RDWR | O_NONBLOCK);
+    /* Already open (e.g. re-entering 2 player mode) */
+    if (serial_open) return 0;
+    
+    rx_head = rx_tail = 0;
+    tx_head = tx_tail = 0;
     
-    if (serial_fd < 0) {
-        printf("Error opening serial port /dev/tty00: %s\n", strerror(errno));
+    if (serial_port_open() != 0) {
+        printf("Error opening serial port\n");
         return 1;
     }
     
-    printf("Serial port /dev/tty00 opened successfully (fd=%d)\n", serial_fd);
+    serial_open = true;
     return 0;
 }
 
-int serial_send_char(char c) {
-    if (serial_fd < 0) {
-        printf("Serial port not initialized\n");
-        return 1;
-    }
+int serial_flush() {
+    if (!serial_open) return 1;
+    if (tx_head == tx_tail) return 0;
     
-    ssize_t result = write(serial_fd, &c, 1);
-    if (result != 1) {
-        printf("Error writing to serial port: %s\n", strerror(errno));
-        return 1;
-    }
-    
-    return 0;
+    return serial_port_start_tx();
 }
 
-int serial_send_string(const char *str) {
-    if (serial_fd < 0) {
+int serial_tx_reserve(size_t len, serial_span_t spans[2]) {
+    if (!serial_open) {
         printf("Serial port not initialized\n");
         return 1;
     }
     
-    size_t len = strlen(str);
-    ssize_t result = write(serial_fd, str, len);
-    
-    if (result != (ssize_t)len) {
-        printf("Error writing string to serial port: %s\n", strerror(errno));
+    if (len > SERIAL_TX_SIZE - (tx_head - tx_tail)) {
+        stats.tx_overflows++;
+        printf("Serial TX ring full, %u bytes not sent\n", (unsigned)len);
         return 1;
     }
     
+    ring_spans(tx_ring, SERIAL_TX_SIZE, tx_head, (uint32_t)len, spans);
     return 0;
 }
 
-bool serial_has_data() {
-    if (serial_fd < 0) return false;
-    
-    /* Try to read one byte without blocking */
-    char dummy;
-    ssize_t result = read(serial_fd, &dummy, 1);
+int serial_tx_commit(size_t len) {
+    tx_head += (uint32_t)len;
+    return serial_flush();
+}
+
+int serial_send(const void *data, size_t len) {
+    serial_span_t spans[2];
+    if (serial_tx_reserve(len, spans) != 0) return 1;
     
-    if (result == 1) {
-        /* Data was available, but we consumed it! 
-           This is a simple implementation limitation */
-        return true;
-    }
+    memcpy(spans[0].data, data, spans[0].len);
+    memcpy(spans[1].data, (const uint8_t *)data + spans[0].len, spans[1].len);
+    return serial_tx_commit(len);
+}
+
+int serial_send_char(char c) {
+    return serial_send(&c, 1);
+}
+
+int serial_send_string(const char *str) {
+    return serial_send(str, strlen(str));
+}
+
+size_t serial_poll() {
+    if (serial_open) serial_port_poll();
+    return rx_head - rx_tail;
+}
+
+size_t serial_available() {
+    return rx_head - rx_tail;
+}
+
+bool serial_peek(char *c) {
+    if (serial_available() == 0) return false;
     
-    return false;
+    *c = (char)rx_ring[rx_tail & (SERIAL_RX_SIZE - 1)];
+    return true;
+}
+
+bool serial_has_data() {
+    return serial_available() > 0;
 }
 
 char serial_read_char() {
-    if (serial_fd < 0) return 0;
+    if (serial_available() == 0) return 0; /* No data available */
     
-    char c;
-    ssize_t result = read(serial_fd, &c, 1);
-    
-    if (result == 1) {
-        return c;
-    }
-    
-    return 0; /* No data available */
+    return (char)rx_ring[rx_tail++ & (SERIAL_RX_SIZE - 1)];
 }
 
-int serial_read_line(char *buffer, int max_len, int timeout_ms) {
-    if (serial_fd < 0 || buffer == NULL || max_len <= 0) return 1;
+size_t serial_read(void *buffer, size_t len) {
+    size_t used = serial_available();
+    if (len > used) len = used;
     
-    int pos = 0;
-    int timeout_ticks = timeout_ms / 50; /* Approximate 50ms per tick */
+    serial_span_t spans[2];
+    ring_spans(rx_ring, SERIAL_RX_SIZE, rx_tail, (uint32_t)len, spans);
+    memcpy(buffer, spans[0].data, spans[0].len);
+    memcpy((uint8_t *)buffer + spans[0].len, spans[1].data, spans[1].len);
+    rx_tail += (uint32_t)len;
     
-    while (pos < max_len - 1 && timeout_ticks > 0) {
-        char c = serial_read_char();
-        
-        if (c != 0) {
-            if (c == '\n' || c == '\r') {
-                buffer[pos] = '\0';
-                return 0; /* Line complete */
-            }
-            buffer[pos++] = c;
-        } else {
-            /* No data, wait a bit */
-            usleep(50000); /* 50ms */
-            timeout_ticks--;
-        }
-    }
-    
-    buffer[pos] = '\0';
-    return (timeout_ticks <= 0) ? 1 : 0; /* Timeout or buffer full */
+    return len;
+}
+
+size_t serial_rx_data(serial_span_t spans[2]) {
+    return ring_spans(rx_ring, SERIAL_RX_SIZE, rx_tail, rx_head - rx_tail, spans);
+}
+
+void serial_rx_consume(size_t len) {
+    rx_tail += (uint32_t)len;
+}
+
+size_t serial_discard() {
+    size_t dropped = rx_head - rx_tail;
+    rx_tail = rx_head;
+    return dropped;
+}
+
+const serial_stats_t *serial_stats() {
+    return &stats;
 }
 
 void serial_cleanup() {
-    if (serial_fd >= 0) {
-        close(serial_fd);
+    if (serial_open) {
+        serial_port_close();
         printf("Serial port closed\n");
-        serial_fd = -1;
+        printf("Serial I/O: %u bytes in %u reads, %u bytes in %u writes, %u interrupts, "
+               "%u RX overflows, %u line errors, %u TX overflows\n",
+               stats.rx_bytes, stats.read_calls, stats.tx_bytes, stats.write_calls, stats.interrupts,
+               stats.rx_overflows, stats.line_errors, stats.tx_overflows);
+        serial_open = false;
     }
 } 
-
@@ -2,10 +2,54 @@
 #define _SERIAL_H_
 
 #include <stdint.h>
+#include <stddef.h>
 #include <stdbool.h>
 
+#define SERIAL_RX_SIZE 1024 /* Receive ring, power of two */
+#define SERIAL_TX_SIZE 1024 /* Transmit ring, power of two */
+
+/**
+ * @brief Serial I/O counters, to check how many bytes each kernel call moves
+ */
+typedef struct {
+  uint32_t read_calls;   /* sys_inb() on the UART, read() on the host, including empty ones */
+  uint32_t write_calls;  /* sys_outb() on the UART, write() on the host */
+  uint32_t rx_bytes;     /* Bytes read from the port */
+  uint32_t tx_bytes;     /* Bytes written to the port */
+  uint32_t interrupts;   /* Serial interrupts handled */
+  uint32_t rx_overflows; /* Bytes dropped because the RX ring was full */
+  uint32_t line_errors;  /* Overrun, parity, framing and break conditions */
+  uint32_t tx_overflows; /* Sends refused because the TX ring was full */
+} serial_stats_t;
+
+/**
+ * @brief Contiguous piece of a ring
+ */
+typedef struct {
+  uint8_t *data;
+  size_t len;
+} serial_span_t;
+
 /**
- * @brief Initialize serial port communication
+ * @brief Subscribe to serial port interrupts (COM1)
+ * @param bit_no Address of memory to be initialized with the bit number to be set in hook_id
+ * @return 0 on success, non-zero on error
+ */
+int serial_subscribe_int(uint8_t *bit_no);
+
+/**
+ * @brief Unsubscribe from serial port interrupts
+ * @return 0 on success, non-zero on error
+ */
+int serial_unsubscribe_int();
+
+/**
+ * @brief Serial interrupt handler: fills the RX ring and refills the TX FIFO
+ */
+void serial_ih();
+
+/**
+ * @brief Initialize serial port communication (empty rings, interrupts on)
  * @return 0 on success, non-zero on error
  */
 int serial_init();
@@ -25,7 +69,40 @@ int serial_send_char(char c);
 int serial_send_string(const char *str);
 
 /**
- * @brief Check if there's data available to read
+ * @brief Queue bytes in the TX ring and flush them
+ * @param data Bytes to send
+ * @param len Number of bytes
+ * @return 0 on success, non-zero if they do not fit in the TX ring
+ */
+int serial_send(const void *data, size_t len);
+
+/**
+ * @brief Start sending the TX ring, the interrupt handler sends the rest
+ * @return 0 on success, non-zero on error
+ */
+int serial_flush();
+
+/**
+ * @brief Move everything the port already received into the RX ring, without waiting for an interrupt
+ * @return Number of bytes now buffered in the RX ring
+ */
+size_t serial_poll();
+
+/**
+ * @brief Get the number of received bytes ready to be read
+ * @return Bytes in the RX ring
+ */
+size_t serial_available();
+
+/**
+ * @brief Look at the next received byte without consuming it
+ * @param c Where to store the byte
+ * @return true if a byte is available, false otherwise
+ */
+bool serial_peek(char *c);
+
+/**
+ * @brief Check if there's data available to read (nothing is consumed)
  * @return true if data available, false otherwise
  */
 bool serial_has_data();
@@ -37,13 +114,52 @@ bool serial_has_data();
 char serial_read_char();
 
 /**
- * @brief Read a line from serial port (blocking with timeout)
- * @param buffer Buffer to store the line
- * @param max_len Maximum length to read
- * @param timeout_ms Timeout in milliseconds
- * @return 0 on success, non-zero on timeout/error
+ * @brief Read up to len received bytes (non-blocking)
+ * @param buffer Where to store the bytes
+ * @param len Maximum number of bytes
+ * @return Number of bytes read
  */
-int serial_read_line(char *buffer, int max_len, int timeout_ms);
+size_t serial_read(void *buffer, size_t len);
+
+/**
+ * @brief Get the received bytes in place, without copying them
+ * @param spans Filled with up to two pieces, in order
+ * @return Bytes in the RX ring
+ */
+size_t serial_rx_data(serial_span_t spans[2]);
+
+/**
+ * @brief Drop received bytes that were used in place
+ * @param len Number of bytes (at most serial_available())
+ */
+void serial_rx_consume(size_t len);
+
+/**
+ * @brief Reserve room at the end of the TX ring to build a message in place
+ * @param len Number of bytes
+ * @param spans Filled with up to two pieces, in order
+ * @return 0 on success, non-zero if they do not fit
+ */
+int serial_tx_reserve(size_t len, serial_span_t spans[2]);
+
+/**
+ * @brief Queue the bytes written into the reserved room and start sending them
+ * @param len Number of bytes (at most the reserved size)
+ * @return 0 on success, non-zero on error
+ */
+int serial_tx_commit(size_t len);
+
+/**
+ * @brief Drop everything in the RX ring (stale messages from an earlier session)
+ * @return Number of bytes dropped
+ */
+size_t serial_discard();
+
+/**
+ * @brief Get the serial I/O counters
+ * @return Counters since the program started
+ */
+const serial_stats_t *serial_stats();
 
 /**
  * @brief Cleanup serial port
@@ -51,4 +167,3 @@ int serial_read_line(char *buffer, int max_len, int timeout_ms);
 void serial_cleanup();
 
 #endif /* _SERIAL_H_ */ 
-
@@ -0,0 +1,68 @@
+#ifndef _SERIAL_PORT_H_
+#define _SERIAL_PORT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "serial.h"
+
+/*
+ * Interface between the serial rings (serial.c) and the device behind them:
+ * the COM1 UART in the game (uart.c), a pseudo-terminal on the host
+ * (tools/serial_pty.c). Devices move bytes with the ring functions below.
+ */
+
+/**
+ * @brief Open and configure the device
+ * @return 0 on success, non-zero on error
+ */
+int serial_port_open();
+
+/**
+ * @brief Stop the device (interrupts off), the rings are kept
+ */
+void serial_port_close();
+
+/**
+ * @brief Start sending the TX ring if the device is idle
+ * @return 0 on success, non-zero on error
+ */
+int serial_port_start_tx();
+
+/**
+ * @brief Move whatever the device already received into the RX ring
+ */
+void serial_port_poll();
+
+/**
+ * @brief Get the free part of the RX ring
+ * @param spans Filled with up to two pieces, in order
+ * @return Free bytes (0 if the ring is full)
+ */
+size_t serial_rx_space(serial_span_t spans[2]);
+
+/**
+ * @brief Mark bytes written into the RX space as received
+ * @param len Number of bytes
+ */
+void serial_rx_commit(size_t len);
+
+/**
+ * @brief Get the queued part of the TX ring
+ * @param spans Filled with up to two pieces, in order
+ * @return Queued bytes
+ */
+size_t serial_tx_pending(serial_span_t spans[2]);
+
+/**
+ * @brief Drop bytes the device has sent from the TX ring
+ * @param len Number of bytes
+ */
+void serial_tx_consume(size_t len);
+
+/**
+ * @brief Counters the device updates (calls, interrupts, errors)
+ * @return Serial counters
+ */
+serial_stats_t *serial_port_stats();
+
+#endif /* _SERIAL_PORT_H_ */
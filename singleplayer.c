@@ -3,10 +3,11 @@
 #include "font.h"
 #include "leaderboard.h"
 #include "gameLogic.h"
+#include "word_index.h"
+#include "rng.h"
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
-#include <time.h>
 
 /* Scancode definitions */
 #define ENTER_MAKE 0x1C
@@ -18,18 +19,6 @@ int singleplayer_draw_category_intro(singleplayer_game_t *game);
 int singleplayer_draw_game_interface(singleplayer_game_t *game);
 int singleplayer_draw_results(singleplayer_game_t *game);
 
-/* Simple random number generator state */
-static uint32_t sp_rand_seed = 1;
-
-/* Simple random functions */
-static uint32_t sp_simple_rand() {
-    sp_rand_seed = sp_rand_seed * 1103515245 + 12345;
-    return (sp_rand_seed / 65536) % 32768;
-}
-
-static void sp_simple_srand(uint32_t seed) {
-    sp_rand_seed = seed;
-}
 
 char singleplayer_scancode_to_char(uint8_t scancode) {
     /* First row: QWERTYUIOP */
@@ -50,22 +39,104 @@ char singleplayer_scancode_to_char(uint8_t scancode) {
     return 0; /* Invalid scancode */
 }
 
-Categoria* singleplayer_get_random_category() {
-    /* Initialize random seed with a more dynamic value to ensure different categories each time */
-    static uint32_t last_time = 0;
-    uint32_t current_time = get_h_res() + get_v_res() + time(NULL);
+const dict_category_t* singleplayer_get_random_category() {
+    int count = dictionary_category_count();
+    if (count == 0) return NULL;
     
-    /* Only seed if time has changed or first call */
-    if (current_time != last_time) {
-        last_time = current_time;
-        sp_simple_srand(current_time ^ ((uint32_t)&categorias * 13) ^ 0xABCDEF);
-        printf("Random seed initialized with %u\n", (unsigned)current_time);
-    }
+    /* The next sequence of the category stream, so both players of a 2 player
+     * session (same seed) pick the same category for the same round */
+    rng_t category_rng;
+    rng_stream(&category_rng, RNG_STREAM_CATEGORY);
     
     /* Select random category */
-    int category_index = sp_simple_rand() % TOTAL_CATEGORIAS;
+    int category_index = (int)rng_range(&category_rng, (uint32_t)count);
     printf("Selected category index: %d\n", category_index);
-    return &categorias[category_index];
+    return dictionary_category(category_index);
+}
+
+/* Metric index of the last large category played, kept while it stays selected */
+#define SP_MAX_CANDIDATES 64
+static word_index_t category_index;
+static const dict_category_t *indexed_category = NULL;
+
+static const char *indexed_key(int word) {
+    return dictionary_string(dictionary_word(indexed_category, word)->key);
+}
+
+/* Build the index for a category unless it is the one already indexed */
+static bool index_category(const dict_category_t *category) {
+    if (indexed_category == category) return true;
+    
+    word_index_free(&category_index);
+    indexed_category = category;
+    if (word_index_build(&category_index, (int)category->word_count, indexed_key) != 0) {
+        indexed_category = NULL;
+        return false;
+    }
+    return true;
+}
+
+/* Closest word within WM_MAX_DISTANCE of current_input (lowest index on ties). If that word is
+ * answered only an unanswered word just as close may stand in, otherwise the input is an answered word.
+ * Returns 1 if the candidates overflowed and the caller must scan instead */
+static int search_index(singleplayer_game_t *game) {
+    wi_result_t candidates[SP_MAX_CANDIDATES];
+    int found = word_index_search(&category_index, game->current_input, WM_MAX_DISTANCE,
+                                  candidates, SP_MAX_CANDIDATES);
+    if (found > SP_MAX_CANDIDATES) return 1;
+    
+    /* Rank every candidate first, answered or not */
+    int best = -1;
+    for (int i = 0; i < found; i++) {
+        if (best < 0 || candidates[i].distance < candidates[best].distance ||
+            (candidates[i].distance == candidates[best].distance && candidates[i].word < candidates[best].word)) {
+            best = i;
+        }
+    }
+    if (best < 0) return 0;
+    
+    int match = -1;
+    for (int i = 0; i < found; i++) {
+        const wi_result_t *c = &candidates[i];
+        if (c->distance != candidates[best].distance || conjuntoContem(&game->answered, c->word)) continue;
+        if (match < 0 || c->word < candidates[match].word) match = i;
+    }
+    if (match < 0) {
+        game->live_answered = true;
+        return 0;
+    }
+    game->live_match = candidates[match].word;
+    game->live_distance = candidates[match].distance;
+    return 0;
+}
+
+/* Resolve current_input against the category after every change of the input */
+static void update_live_match(singleplayer_game_t *game) {
+    if (game->use_matcher) {
+        /* Matcher categories have at most 32 words, all in the first block */
+        uint32_t answered = game->answered.blocos[0];
+        game->live_match = word_matcher_resolve(&game->matcher, answered);
+        game->live_distance = word_matcher_distance(&game->matcher, game->live_match);
+        game->live_answered = (word_matcher_close_words(&game->matcher) & answered) != 0;
+        game->live_prefix = word_matcher_on_prefix(&game->matcher);
+        return;
+    }
+    
+    game->live_match = -1;
+    game->live_distance = -1;
+    game->live_answered = false;
+    game->live_prefix = false;
+    if (game->input_length == 0) return;
+    
+    if (game->use_index && search_index(game) == 0) return;
+    
+    game->live_match = procurarPalavra(game->current_category, game->current_input, &game->answered);
+    if (game->live_match >= 0) {
+        const dict_word_t *entry = dictionary_word(game->current_category, game->live_match);
+        game->live_distance = distanciaLevenshtein(game->current_input, dictionary_string(entry->key));
+    } else {
+        game->live_answered = procurarPalavra(game->current_category, game->current_input, NULL) >= 0;
+    }
 }
 
 int singleplayer_init(singleplayer_game_t *game, const char *player_initials, char caught_letter) {
@@ -88,32 +159,44 @@ int singleplayer_init(singleplayer_game_t *game, const char *player_initials, ch
     if (game->current_category == NULL) return 1;
     
     /* Find category index for debugging */
-    for (int i = 0; i < TOTAL_CATEGORIAS; i++) {
-        if (&categorias[i] == game->current_category) {
-            game->category_index = i;
-            break;
-        }
+    game->category_index = (int)(game->current_category - dictionary_category(0));
+    game->category_name = dictionary_string(game->current_category->name);
+    
+    /* Letter statistics for the caught letter */
+    game->caught_letter_bit = bitLetra(caught_letter);
+    game->words_with_letter = 0;
+    for (int i = 0; i < (int)game->current_category->word_count; i++) {
+        if (dictionary_word(game->current_category, i)->letters & game->caught_letter_bit) game->words_with_letter++;
+    }
+    
+    /* Compile small categories for as-you-type matching, index large ones */
+    game->use_matcher = word_matcher_init(&game->matcher, game->current_category) == 0;
+    if (!game->use_matcher) {
+        game->use_index = index_category(game->current_category);
+        printf("Category '%s' has %u words, matching by %s\n", game->category_name,
+               (unsigned)game->current_category->word_count, game->use_index ? "index" : "scan");
     }
     
-    /* Initialize game progress */
+    /* Initialize game progress (answered/scored sets were cleared above) */
     game->answered_count = 0;
     game->total_score = 0;
     game->input_length = 0;
+    update_live_match(game);
     
     /* Initialize timer - 35 seconds */
-    game->timer_ticks = 0;
+    game->start_ns = 0;
     game->remaining_seconds = GAME_TIME_SECONDS;
     
     /* Initialize UI state */
     game->show_cursor = true;
-    game->cursor_counter = 0;
+    game->cursor_start_ns = hrclock_now_ns();
     
     /* Initialize results */
     game->all_words_found = false;
     game->time_expired = false;
     
     printf("SinglePlayer initialized: Category='%s', Player='%s', Letter='%c'\n", 
-           game->current_category->nome, game->player_initials, game->caught_letter);
+           game->category_name, game->player_initials, game->caught_letter);
     
     return 0;
 }
@@ -122,30 +205,31 @@ int singleplayer_update(singleplayer_game_t *game) {
     if (game == NULL || !game->game_active) return 1;
     
     /* Update cursor blinking */
-    game->cursor_counter++;
-    if (game->cursor_counter >= 30) { /* Blink every half second at 60Hz */
-        game->show_cursor = !game->show_cursor;
-        game->cursor_counter = 0;
+    bool cursor = (hrclock_elapsed_ns(game->cursor_start_ns) / CURSOR_BLINK_PERIOD_NS) % 2 == 0;
+    if (cursor != game->show_cursor) {
+        game->show_cursor = cursor;
+        if (game->state != SP_STATE_FINISHED) request_page_redraw();
     }
     
     /* Update timer only during gameplay */
     if (game->state == SP_STATE_PLAYING) {
-        game->timer_ticks++;
+        uint64_t elapsed_s = hrclock_elapsed_ns(game->start_ns) / NS_PER_SEC;
         
-        /* Update remaining seconds every 60 ticks (1 second at 60Hz) */
-        if (game->timer_ticks >= TIMER_FREQUENCY) {
-            game->timer_ticks = 0;
-            
-            if (game->remaining_seconds > 0) {
-                game->remaining_seconds--;
-            } else {
-                /* Time expired */
-                game->time_expired = true;
-                game->state = SP_STATE_FINISHED;
-                game->game_active = false;
-                printf("Time expired! Final score: %d\n", game->total_score);
-                return 1; /* Game finished */
-            }
+        if (elapsed_s >= GAME_TIME_SECONDS) {
+            /* Time expired */
+            game->remaining_seconds = 0;
+            game->time_expired = true;
+            game->state = SP_STATE_FINISHED;
+            game->game_active = false;
+            request_page_redraw();
+            printf("Time expired! Final score: %d\n", game->total_score);
+            return 1; /* Game finished */
+        }
+        
+        uint32_t remaining = (uint32_t)(GAME_TIME_SECONDS - elapsed_s);
+        if (remaining != game->remaining_seconds) {
+            game->remaining_seconds = remaining;
+            request_page_redraw();
         }
         
         /* Check if all words found */
@@ -153,6 +237,7 @@ int singleplayer_update(singleplayer_game_t *game) {
             game->all_words_found = true;
             game->state = SP_STATE_FINISHED;
             game->game_active = false;
+            request_page_redraw();
             printf("All words found! Final score: %d\n", game->total_score);
             return 1; /* Game finished */
         }
@@ -222,11 +307,11 @@ int singleplayer_draw_category_intro(singleplayer_game_t *game) {
     
     /* Draw category name */
     uint8_t cat_scale = 4;
-    uint16_t cat_width = strlen(game->current_category->nome) * 8 * cat_scale;
+    uint16_t cat_width = strlen(game->category_name) * 8 * cat_scale;
     uint16_t cat_x = (get_h_res() - cat_width) / 2;
     uint16_t cat_y = line_y + 80;
     
-    if (draw_string_scaled(cat_x, cat_y, game->current_category->nome, yellow, cat_scale) != 0) return 1;
+    if (draw_string_scaled(cat_x, cat_y, game->category_name, yellow, cat_scale) != 0) return 1;
     
     /* Draw player info */
     char player_info[100];
@@ -234,10 +319,17 @@ int singleplayer_draw_category_intro(singleplayer_game_t *game) {
     uint16_t info_x = (get_h_res() - strlen(player_info) * 8 * 2) / 2;
     if (draw_string_scaled(info_x, cat_y + 100, player_info, white, 2) != 0) return 1;
     
+    /* How many words can still earn points with this letter */
+    char letter_info[100];
+    sprintf(letter_info, "%d de %d palavras contem a letra %c", game->words_with_letter,
+            (int)game->current_category->word_count, game->caught_letter);
+    uint16_t letter_info_x = (get_h_res() - strlen(letter_info) * 8) / 2;
+    if (draw_string_scaled(letter_info_x, cat_y + 130, letter_info, yellow, 1) != 0) return 1;
+    
     /* Draw instructions */
     const char *instr1 = "Escreva palavras desta categoria";
     const char *instr2 = "Tem 35 segundos para encontrar o maximo possivel";
-    const char *instr3 = "Prima ENTER para comecar";
+    const char *instr3 = game->start_pending ? "A aguardar o outro jogador..." : "Prima ENTER para comecar";
     
     uint16_t instr_y = cat_y + 180;
     uint16_t instr1_x = (get_h_res() - strlen(instr1) * 8 * 2) / 2;
@@ -256,9 +348,9 @@ int singleplayer_draw_category_intro(singleplayer_game_t *game) {
     /* Show first 3 words as examples */
     char examples[200] = "";
     int shown = 0;
-    for (int i = 0; i < game->current_category->totalPalavras && shown < 3; i++) {
+    for (int i = 0; i < (int)game->current_category->word_count && shown < 3; i++) {
         if (shown > 0) strcat(examples, ", ");
-        strcat(examples, game->current_category->palavras[i]);
+        strcat(examples, dictionary_string(dictionary_word(game->current_category, i)->text));
         shown++;
     }
     strcat(examples, "...");
@@ -271,6 +363,7 @@ int singleplayer_draw_category_intro(singleplayer_game_t *game) {
 
 int singleplayer_draw_game_interface(singleplayer_game_t *game) {
     uint32_t white = 0xffffff;
+    uint32_t orange = 0xff6b35;
     uint32_t yellow = 0xffd700;
     uint32_t green = 0x00ff88;
     uint32_t red = 0xff4444;
@@ -278,9 +371,9 @@ int singleplayer_draw_game_interface(singleplayer_game_t *game) {
     
     /* Draw category title centered on first line */
     uint16_t title_y = 50;
-    uint16_t category_width = strlen(game->current_category->nome) * 8 * 2;
+    uint16_t category_width = strlen(game->category_name) * 8 * 2;
     uint16_t category_x = (get_h_res() - category_width) / 2;
-    if (draw_string_scaled(category_x, title_y, game->current_category->nome, yellow, 2) != 0) return 1;
+    if (draw_string_scaled(category_x, title_y, game->category_name, yellow, 2) != 0) return 1;
     
     /* Draw time and points on second line */
     char timer_info[50];
@@ -295,6 +388,16 @@ int singleplayer_draw_game_interface(singleplayer_game_t *game) {
     
     if (draw_string_scaled(timer_info_x, timer_info_y, timer_info, white, 2) != 0) return 1;
     
+    /* Other player's live progress in 2 player mode */
+    const mp_progress_t *opponent = get_mp_opponent_progress();
+    if (opponent != NULL) {
+        char opponent_info[64];
+        sprintf(opponent_info, "Adversario %s: %d pontos | %d palavras",
+                opponent->initials, opponent->score, opponent->words);
+        uint16_t opponent_x = (get_h_res() - strlen(opponent_info) * 8) / 2;
+        if (draw_string_scaled(opponent_x, title_y - 30, opponent_info, orange, 1) != 0) return 1;
+    }
+    
     /* Draw timer bar below time info */
     uint16_t timer_bar_width = 300;
     uint16_t timer_bar_height = 15;
@@ -323,9 +426,26 @@ int singleplayer_draw_game_interface(singleplayer_game_t *game) {
     /* Input field border */
     if (draw_rectangle_border(input_field_x, input_field_y, input_field_width, input_field_height, yellow, 2) != 0) return 1;
     
+    /* Live matching feedback, kept up to date by every keystroke */
+    const char *input_instr = "Digite uma palavra e prima ENTER";
+    uint32_t input_color = white;
+    uint32_t instr_color = white;
+    if (game->input_length > 0) {
+        if (game->live_match >= 0) {
+            input_instr = game->live_distance == 0 ?
+                          "Palavra valida! Prima ENTER" : "Quase! Prima ENTER para tentar";
+            input_color = instr_color = green;
+        } else if (game->live_answered) {
+            input_instr = "Essa palavra ja foi encontrada";
+            instr_color = red;
+        } else if (game->live_prefix) {
+            input_instr = "Continue...";
+        }
+    }
+    
     /* Draw current input */
     if (game->input_length > 0) {
-        if (draw_string_scaled(input_field_x + 10, input_field_y + 15, game->current_input, white, 2) != 0) return 1;
+        if (draw_string_scaled(input_field_x + 10, input_field_y + 15, game->current_input, input_color, 2) != 0) return 1;
     }
     
     /* Draw cursor */
@@ -335,51 +455,56 @@ int singleplayer_draw_game_interface(singleplayer_game_t *game) {
     }
     
     /* Draw instruction */
-    const char *input_instr = "Digite uma palavra e prima ENTER";
     uint16_t instr_width = strlen(input_instr) * 8; /* Width of text at scale 1 */
     uint16_t instr_x = (get_h_res() - instr_width) / 2; /* Center horizontally */
-    if (draw_string_scaled(instr_x, input_field_y + input_field_height + 10, input_instr, white, 1) != 0) return 1;
+    if (draw_string_scaled(instr_x, input_field_y + input_field_height + 10, input_instr, instr_color, 1) != 0) return 1;
     
     /* Draw answered words heading */
     uint16_t words_start_y = input_field_y + input_field_height + 40; /* 40px below input field instructions */
     if (draw_string_scaled(50, words_start_y, "Palavras encontradas:", yellow, 2) != 0) return 1;
     
-    /* Show answered words in columns */
-    uint16_t col_width = 200;
+    /* Show answered words in columns across the screen; only the first MAX_SHOWN_WORDS are kept */
     uint16_t words_per_col = 12;
+    uint16_t col_count = MAX_SHOWN_WORDS / words_per_col;
+    uint16_t col_width = (get_h_res() - 2 * 50) / col_count;
+    int col_chars = col_width / 8 - 1; /* Characters at scale 1, one left as a gap */
     uint16_t word_y = words_start_y + 30;
+    int shown = game->answered_count < MAX_SHOWN_WORDS ? game->answered_count : MAX_SHOWN_WORDS;
     
-    for (int i = 0; i < game->answered_count; i++) {
+    for (int i = 0; i < shown; i++) {
         uint16_t col = i / words_per_col;
         uint16_t row = i % words_per_col;
         uint16_t word_x = 50 + col * col_width;
         uint16_t draw_y = word_y + row * 18;
         
         char word_with_score[50];
-        /* Find score for this word */
-        int word_score = 0;
-        for (int j = 0; j < game->current_category->totalPontuacoes; j++) {
-            if (strcmp(game->answered_words[i], game->current_category->pontuacoes[j].palavra) == 0) {
-                word_score = game->current_category->pontuacoes[j].pontuacao;
-                break;
-            }
-        }
+        int index = game->answered_order[i];
+        const dict_word_t *entry = dictionary_word(game->current_category, index);
         
         /* Format display text based on if word contains the caught letter */
-        if (game->word_contains_letter[i]) {
-            sprintf(word_with_score, "%s (+%d)", game->answered_words[i], word_score);
-            /* Normal words in green */
-            if (draw_string_scaled(word_x, draw_y, word_with_score, green, 1) != 0) return 1;
+        uint32_t word_color;
+        if (conjuntoContem(&game->scored, index)) {
+            snprintf(word_with_score, sizeof(word_with_score), "%s (+%d)", dictionary_string(entry->text), entry->score);
+            word_color = green; /* Normal words in green */
         } else {
-            sprintf(word_with_score, "%s (+0)", game->answered_words[i]);
-            /* Words without the caught letter in red */
-            if (draw_string_scaled(word_x, draw_y, word_with_score, red, 1) != 0) return 1;
+            snprintf(word_with_score, sizeof(word_with_score), "%s (+0)", dictionary_string(entry->text));
+            word_color = red; /* Words without the caught letter in red */
         }
+        
+        /* Cut to the column width */
+        if (col_chars >= 0 && col_chars < (int)sizeof(word_with_score)) word_with_score[col_chars] = '\0';
+        if (draw_string_scaled(word_x, draw_y, word_with_score, word_color, 1) != 0) return 1;
+    }
+    
+    if (game->answered_count > shown) {
+        char more[32];
+        sprintf(more, "+%d mais", game->answered_count - shown);
+        if (draw_string_scaled(50, word_y + words_per_col * 18, more, yellow, 1) != 0) return 1;
     }
     
     /* Draw progress */
     char progress[100];
-    sprintf(progress, "Progresso: %d/%d palavras", game->answered_count, game->current_category->totalPontuacoes);
+    sprintf(progress, "Progresso: %d/%d palavras", game->answered_count, (int)game->current_category->word_count);
     if (draw_string_scaled(50, get_v_res() - 60, progress, light_blue, 1) != 0) return 1;
     
     return 0;
@@ -411,12 +536,12 @@ int singleplayer_draw_results(singleplayer_game_t *game) {
     
     /* Draw statistics */
     char stats[200];
-    sprintf(stats, "Categoria: %s | Jogador: %s", game->current_category->nome, game->player_initials);
+    sprintf(stats, "Categoria: %s | Jogador: %s", game->category_name, game->player_initials);
     uint16_t stats_x = (get_h_res() - strlen(stats) * 8 * 2) / 2;
     if (draw_string_scaled(stats_x, title_y + 150, stats, white, 2) != 0) return 1;
     
     char progress[100];
-    sprintf(progress, "Palavras encontradas: %d de %d", game->answered_count, game->current_category->totalPontuacoes);
+    sprintf(progress, "Palavras encontradas: %d de %d", game->answered_count, (int)game->current_category->word_count);
     uint16_t progress_x = (get_h_res() - strlen(progress) * 8 * 2) / 2;
     if (draw_string_scaled(progress_x, title_y + 180, progress, light_blue, 2) != 0) return 1;
     
@@ -435,14 +560,21 @@ int singleplayer_draw_results(singleplayer_game_t *game) {
     return 0;
 }
 
+void singleplayer_start_playing(singleplayer_game_t *game, uint64_t start_ns) {
+    game->state = SP_STATE_PLAYING;
+    game->start_ns = start_ns;
+    game->start_pending = false;
+    request_page_redraw();
+    printf("Starting gameplay phase\n");
+}
+
 int singleplayer_handle_input(singleplayer_game_t *game, uint8_t scancode) {
     if (game == NULL) return 1;
     
     switch (game->state) {
         case SP_STATE_STARTING:
             if (scancode == ENTER_MAKE) {
-                game->state = SP_STATE_PLAYING;
-                printf("Starting gameplay phase\n");
+                singleplayer_start_playing(game, hrclock_now_ns());
                 return 0;
             }
             break;
@@ -495,9 +627,12 @@ int singleplayer_add_char(singleplayer_game_t *game, char c) {
     
     /* Only allow letters */
     if (c >= 'a' && c <= 'z') {
+        if (game->use_matcher && word_matcher_push(&game->matcher, c) != 0) return 1;
         game->current_input[game->input_length] = c;
         game->input_length++;
         game->current_input[game->input_length] = '\0';
+        update_live_match(game);
+        request_page_redraw();
         return 0;
     }
     
@@ -508,6 +643,9 @@ void singleplayer_remove_char(singleplayer_game_t *game) {
     if (game->input_length > 0) {
         game->input_length--;
         game->current_input[game->input_length] = '\0';
+        if (game->use_matcher) word_matcher_pop(&game->matcher);
+        update_live_match(game);
+        request_page_redraw();
     }
 }
 
@@ -516,113 +654,62 @@ int singleplayer_submit_word(singleplayer_game_t *game) {
         return 0; /* Empty input */
     }
     
-    /* Check if the word is in the dictionary of the theme */
-    int score = singleplayer_check_word(game, game->current_input);
+    /* Already resolved while typing: closest category word, -1 if that word was already found */
+    int index = game->live_match;
+    int score = 0;
     
-    if (score > 0) {
-        /* Check if the word contains the caught letter */
-        char caught_letter = tolower((unsigned char)game->caught_letter);
-        bool contains_letter = false;
+    if (index >= 0) {
+        const dict_word_t *entry = dictionary_word(game->current_category, index);
+        score = entry->score;
         
-        /* Convert input to lowercase for comparison */
-        char input_lower[MAX_INPUT_LENGTH];
-        strncpy(input_lower, game->current_input, MAX_INPUT_LENGTH - 1);
-        input_lower[MAX_INPUT_LENGTH - 1] = '\0';
+        /* Check if the matched category word (not the typed one) contains the caught letter */
+        bool contains_letter = (entry->letters & game->caught_letter_bit) != 0;
         
-        /* Convert to lowercase */
-        for (int j = 0; input_lower[j]; j++) {
-            input_lower[j] = tolower((unsigned char)input_lower[j]);
-            
-            /* Check if this character matches the caught letter */
-            if (input_lower[j] == caught_letter) {
-                contains_letter = true;
-                break;
-            }
+        conjuntoAdicionar(&game->answered, index);
+        if (game->answered_count < MAX_SHOWN_WORDS) {
+            game->answered_order[game->answered_count] = (uint16_t)index;
         }
+        game->answered_count++;
         
-        /* Find the correct word in the category to add to answered list */
-        /* We need to find which word in the category matches our input */
-        for (int i = 0; i < game->current_category->totalPontuacoes; i++) {
-            char categoria_word[MAX_TAMANHO_PALAVRA];
-            strncpy(categoria_word, game->current_category->pontuacoes[i].palavra, MAX_TAMANHO_PALAVRA - 1);
-            categoria_word[MAX_TAMANHO_PALAVRA - 1] = '\0';
-            
-            /* Convert both to lowercase for comparison */
-            char cat_lower[MAX_TAMANHO_PALAVRA];
-            
-            strncpy(cat_lower, categoria_word, MAX_TAMANHO_PALAVRA - 1);
-            cat_lower[MAX_TAMANHO_PALAVRA - 1] = '\0';
-            
-            /* Convert to lowercase */
-            for (int j = 0; cat_lower[j]; j++) {
-                cat_lower[j] = tolower((unsigned char)cat_lower[j]);
-            }
-            
-            /* Remove accents from both */
-            removerAcentos(input_lower);
-            removerAcentos(cat_lower);
-            
-            /* Check if they match (with distance <= 1) */
-            if (distanciaLevenshtein(input_lower, cat_lower) <= 1) {
-                /* Add the original word from category to answered list */
-                strncpy(game->answered_words[game->answered_count], categoria_word, MAX_TAMANHO_PALAVRA - 1);
-                game->answered_words[game->answered_count][MAX_TAMANHO_PALAVRA - 1] = '\0';
-                
-                /* Store whether the word contains the caught letter */
-                game->word_contains_letter[game->answered_count] = contains_letter;
-                
-                /* Only add points if the word contains the caught letter */
-                if (contains_letter) {
-                    game->total_score += score;
-                    printf("Word '%s' accepted as '%s', score: %d, total: %d\n", 
-                          game->current_input, categoria_word, score, game->total_score);
-                } else {
-                    printf("Word '%s' accepted as '%s', but +0 points (missing letter '%c')\n", 
-                          game->current_input, categoria_word, game->caught_letter);
-                }
-                
-                game->answered_count++;
-                break;
-            }
+        /* Only add points if the word contains the caught letter */
+        if (contains_letter) {
+            conjuntoAdicionar(&game->scored, index);
+            game->total_score += score;
+            printf("Word '%s' accepted as '%s', score: %d, total: %d\n", 
+                  game->current_input, dictionary_string(entry->text), score, game->total_score);
+        } else {
+            printf("Word '%s' accepted as '%s', but +0 points (missing letter '%c')\n", 
+                  game->current_input, dictionary_string(entry->text), game->caught_letter);
         }
     }
     
     /* Clear input */
     game->input_length = 0;
     game->current_input[0] = '\0';
+    if (game->use_matcher) word_matcher_reset(&game->matcher);
+    update_live_match(game);
+    request_page_redraw();
     
     return score;
 }
 
-int singleplayer_check_word(singleplayer_game_t *game, const char *word) {
+int singleplayer_find_word(singleplayer_game_t *game, const char *word) {
     if (game == NULL || word == NULL || game->current_category == NULL) {
-        return 0;
-    }
-    
-    /* Check if word was already answered */
-    for (int i = 0; i < game->answered_count; i++) {
-        if (strcmp(game->answered_words[i], word) == 0) {
-            return 0; /* Already answered */
-        }
+        return -1;
     }
     
-    /* Create a temporary copy of answered words for verification */
-    char temp_answered[MAX_ANSWERED_WORDS][MAX_ENTRADA];
-    int temp_count = game->answered_count;
+    return procurarPalavra(game->current_category, word, NULL);
+}
+
+int singleplayer_check_word(singleplayer_game_t *game, const char *word) {
+    int index = singleplayer_find_word(game, word);
     
-    /* Copy current answered words to temp array */
-    for (int i = 0; i < game->answered_count; i++) {
-        strncpy(temp_answered[i], game->answered_words[i], MAX_ENTRADA - 1);
-        temp_answered[i][MAX_ENTRADA - 1] = '\0';
+    /* Unknown or already answered words are worth nothing */
+    if (index < 0 || conjuntoContem(&game->answered, index)) {
+        return 0;
     }
     
-    /* Use the game logic from gameLogic.c to verify the word */
-    int score = verificarEntrada(game->current_category, temp_answered, &temp_count, word);
-    
-    /* If the word is valid and was added to temp_answered, we know it's correct */
-    /* But we don't update game->answered_words here - that's done in submit_word */
-    
-    return score;
+    return dictionary_word(game->current_category, index)->score;
 }
 
 bool singleplayer_all_words_found(singleplayer_game_t *game) {
@@ -630,7 +717,7 @@ bool singleplayer_all_words_found(singleplayer_game_t *game) {
         return false;
     }
     
-    return game->answered_count >= game->current_category->totalPontuacoes;
+    return contarPalavras(&game->answered) >= (int)game->current_category->word_count;
 }
 
 uint32_t singleplayer_get_time_remaining(singleplayer_game_t *game) {
@@ -641,9 +728,9 @@ uint32_t singleplayer_get_time_remaining(singleplayer_game_t *game) {
 void singleplayer_save_score(singleplayer_game_t *game) {
     if (game == NULL || game->current_category == NULL) return;
     
-    guardarPontuacao(game->total_score, game->player_initials, game->current_category->nome);
+    guardarPontuacao(game->total_score, game->player_initials, game->category_name);
     printf("Score saved: %d points for %s in category %s\n", 
-           game->total_score, game->player_initials, game->current_category->nome);
+           game->total_score, game->player_initials, game->category_name);
 }
 
 void singleplayer_cleanup(singleplayer_game_t *game) {
@@ -655,7 +742,9 @@ void singleplayer_cleanup(singleplayer_game_t *game) {
     
     /* Clear sensitive data */
     memset(game->current_input, 0, sizeof(game->current_input));
-    memset(game->answered_words, 0, sizeof(game->answered_words));
+    memset(&game->answered, 0, sizeof(game->answered));
+    memset(&game->scored, 0, sizeof(game->scored));
+    game->answered_count = 0;
     
     printf("SinglePlayer game cleaned up\n");
 }
@@ -3,12 +3,15 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "dicionarios.h"
+#include "dictionary.h"
+#include "gameLogic.h"
+#include "hrclock.h"
+#include "word_match.h"
 
 #define MAX_INPUT_LENGTH 30
-#define MAX_ANSWERED_WORDS 50
+#define MAX_SHOWN_WORDS 48   /* Found words listed on screen (4 columns of 12, the rest counted) */
 #define GAME_TIME_SECONDS 35
-#define TIMER_FREQUENCY 120  /* Adjusted timer frequency to match actual system frequency */
+#define CURSOR_BLINK_PERIOD_NS (500 * NS_PER_MS) /* Input cursor toggles every half second */
 
 /* Single Player Game States */
 typedef enum {
@@ -25,30 +28,44 @@ typedef struct {
     bool game_active;
     
     /* Selected Category */
-    Categoria *current_category;
+    const dict_category_t *current_category;
+    const char *category_name;  /* Category name (dictionary string) */
     int category_index;
     
     /* Player Info */
     char player_initials[4];
     char caught_letter;  /* Letter from letter rain */
     
-    /* Game Progress */
-    char answered_words[MAX_ANSWERED_WORDS][MAX_TAMANHO_PALAVRA];
-    bool word_contains_letter[MAX_ANSWERED_WORDS]; /* Track words containing the caught letter */
-    int answered_count;
+    /* Caught letter against the precomputed word letter masks (bit 0 = 'a') */
+    uint32_t caught_letter_bit;    /* Mask bit of caught_letter */
+    int words_with_letter;         /* Category words that contain caught_letter */
+    
+    /* Game Progress (bit i refers to word i of current_category) */
+    conjunto_palavras_t answered;              /* Words found so far */
+    conjunto_palavras_t scored;                /* Found words that earned points (contain the caught letter) */
+    uint16_t answered_order[MAX_SHOWN_WORDS];  /* First word indices in the order they were found */
+    int answered_count;                        /* Number of words in answered */
     int total_score;
     
     /* Current Input */
     char current_input[MAX_INPUT_LENGTH];
     int input_length;
+    bool use_matcher;        /* Category is small enough for the per-keystroke matcher */
+    word_matcher_t matcher;  /* Matching state of current_input, updated per keystroke */
+    bool use_index;          /* Larger category, searched through its BK-tree index */
+    int live_match;          /* Word current_input resolves to, -1 if none */
+    int live_distance;       /* Edit distance to live_match */
+    bool live_answered;      /* current_input is close to a word already found */
+    bool live_prefix;        /* current_input is the exact start of some word */
     
     /* Timer */
-    uint32_t timer_ticks;
+    uint64_t start_ns;          /* Clock time the playing phase started (may be ahead of now) */
+    bool start_pending;         /* 2 player mode: ENTER pressed, waiting for the shared start time */
     uint32_t remaining_seconds;
     
     /* UI State */
     bool show_cursor;
-    uint32_t cursor_counter;
+    uint64_t cursor_start_ns;   /* Clock time the cursor blinking started */
     
     /* Game Results */
     bool all_words_found;
@@ -82,6 +99,14 @@ int singleplayer_update(singleplayer_game_t *game);
  */
 int singleplayer_draw(singleplayer_game_t *game);
 
+/**
+ * @brief Leave the category page and start the 35 second word phase
+ * 
+ * @param game Pointer to game structure
+ * @param start_ns Clock time the word phase starts (the timer holds until then)
+ */
+void singleplayer_start_playing(singleplayer_game_t *game, uint64_t start_ns);
+
 /**
  * @brief Handle keyboard input for single player game
  * 
@@ -91,12 +116,21 @@ int singleplayer_draw(singleplayer_game_t *game);
  */
 int singleplayer_handle_input(singleplayer_game_t *game, uint8_t scancode);
 
+/**
+ * @brief Find the category word an input matches
+ * 
+ * @param game Pointer to game structure
+ * @param word Word to look up (may contain one typo)
+ * @return Word index in current_category, -1 if no word matches
+ */
+int singleplayer_find_word(singleplayer_game_t *game, const char *word);
+
 /**
  * @brief Check if a word is valid for the current category
  * 
  * @param game Pointer to game structure
  * @param word Word to check
- * @return Score (0 if invalid, positive if valid)
+ * @return Score (0 if invalid or already answered, positive if valid)
  */
 int singleplayer_check_word(singleplayer_game_t *game, const char *word);
 
@@ -150,9 +184,9 @@ void singleplayer_cleanup(singleplayer_game_t *game);
 /**
  * @brief Get a random category from the available categories
  * 
- * @return Pointer to randomly selected category
+ * @return Pointer to randomly selected category, NULL if there is no dictionary
  */
-Categoria* singleplayer_get_random_category();
+const dict_category_t* singleplayer_get_random_category();
 
 /**
  * @brief Save final score to leaderboard
@@ -161,6 +195,13 @@ Categoria* singleplayer_get_random_category();
  */
 void singleplayer_save_score(singleplayer_game_t *game);
 
+/**
+ * @brief Get the word phase game instance, starting it on first use
+ * 
+ * @return Pointer to the game structure (owned by videocard.c)
+ */
+singleplayer_game_t* get_singleplayer_game();
+
 /**
  * @brief Convert scancode to character (for Portuguese keyboard)
  * 
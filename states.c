@@ -0,0 +1,581 @@
+#include "states.h"
+#include "videocard.h"
+#include "mouse.h"
+#include "leaderboard.h"
+#include "game.h"
+#include "singleplayer.h"
+#include "serial.h"
+#include "hrclock.h"
+#include "i8254.h"
+#include "alloc_stats.h"
+#include <stdio.h>
+
+/* Scancode definitions */
+#define ESC_MAKE 0x01
+#define ENTER_MAKE 0x1C
+#define T_MAKE 0x14
+
+#define MAX_TRANSITION_HOOKS 4
+
+static game_state_t current_state = STATE_MAIN_MENU;
+static bool page_dirty = true;    /* Current page must be redrawn before the next driver_receive */
+static bool quit_requested = false;
+static uint32_t ticks_in_state = 0;
+static uint64_t state_entered_ns = 0; /* Clock time of the last transition */
+static uint64_t last_tick_ns = 0;     /* Clock time of the previous timer interrupt */
+static uint64_t frame_dt_ns = 0;      /* Real time between the last two timer interrupts */
+static uint32_t tick_hz = DEFAULT_TICK_HZ; /* Timer 0 rate currently programmed */
+
+static state_stats_t state_stats[STATE_COUNT];
+static uint32_t allocs_mark = 0;      /* Allocation count when the current state finished setting up */
+static int transition_depth = 0;      /* Nested set_game_state calls (on_enter may transition) */
+static state_transition_hook_t transition_hooks[MAX_TRANSITION_HOOKS];
+static int transition_hook_count = 0;
+
+/* ---------- Shared handlers ---------- */
+
+/* Redraw menu-like pages when the mouse moved (hover effects and cursor) */
+static void menu_page_mouse_moved() {
+  if (mouse_menu_needs_redraw() || mouse_should_redraw_page()) {
+    request_page_redraw();
+    mouse_clear_redraw_flag();
+    mouse_clear_page_redraw_flag();
+  }
+}
+
+/* ---------- Main menu ---------- */
+
+static void main_menu_enter(game_state_t from) {
+  bool leaving_multiplayer = is_in_multiplayer_mode() || from == STATE_MULTIPLAYER ||
+                             from == STATE_MULTIPLAYER_TEST || from == STATE_MP_WAITING_FOR_OTHER_PLAYER ||
+                             from == STATE_MP_RESULTS;
+
+  /* Everything started from the menu ends here */
+  reset_singleplayer();
+  serial_cleanup();
+  if (leaving_multiplayer) {
+    reset_multiplayer_connection();
+  }
+}
+
+static void main_menu_mouse(struct packet *pp) {
+  menu_page_mouse_moved();
+
+  if (pp->lb) {
+    /* handle_menu_click changes the state itself */
+    if (handle_menu_click(mouse_get_x(), mouse_get_y(), true) == 1) {
+      states_request_quit();
+    }
+  }
+}
+
+static int main_menu_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_main_page_with_hover(mouse_x, mouse_y);
+}
+
+/* ---------- Single player setup ---------- */
+
+static void single_player_enter(game_state_t from) {
+  /* Initialize game and move to initials entry immediately */
+  game_init(get_current_game());
+  set_game_state(STATE_SP_ENTER_INITIALS);
+}
+
+static int single_player_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_init_sp_game();
+}
+
+/* ---------- Multiplayer setup and connection ---------- */
+
+static void multiplayer_enter(game_state_t from) {
+  /* Moves on to STATE_MULTIPLAYER_TEST if the serial port opens */
+  init_mp_game();
+}
+
+static int multiplayer_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_init_mp_game();
+}
+
+static void multiplayer_test_enter(game_state_t from) {
+  start_multiplayer_test();
+}
+
+static void multiplayer_test_tick() {
+  update_multiplayer_test();
+}
+
+static void multiplayer_test_serial() {
+  receive_multiplayer_test();
+}
+
+static int multiplayer_test_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_multiplayer_test_screen();
+}
+
+static void mp_waiting_enter(game_state_t from) {
+  start_mp_waiting_for_other_player();
+}
+
+static void mp_waiting_tick() {
+  update_mp_waiting_for_other_player();
+}
+
+static void mp_waiting_serial() {
+  receive_mp_waiting_for_other_player();
+}
+
+static int mp_waiting_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_mp_waiting_for_other_player();
+}
+
+static void mp_results_serial() {
+  receive_mp_results();
+}
+
+static int mp_results_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_mp_results_screen();
+}
+
+/* ---------- Leaderboard and instructions ---------- */
+
+static void leaderboard_mouse(struct packet *pp) {
+  menu_page_mouse_moved();
+
+  if (pp->lb && handle_leaderboard_click(mouse_get_x(), mouse_get_y(), true) == 1) {
+    /* Back button clicked */
+    set_game_state(STATE_MAIN_MENU);
+  }
+}
+
+static int leaderboard_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_leaderboard_with_hover(mouse_x, mouse_y);
+}
+
+static void instructions_mouse(struct packet *pp) {
+  menu_page_mouse_moved();
+
+  if (pp->lb && handle_instructions_click(mouse_get_x(), mouse_get_y(), true) == 1) {
+    /* Back button clicked */
+    set_game_state(STATE_MAIN_MENU);
+  }
+}
+
+static int instructions_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_instructions_with_mouse(mouse_x, mouse_y);
+}
+
+/* ---------- Enter initials ---------- */
+
+/* Both players count down together once both have entered their initials */
+static void initials_confirmed() {
+  printf("Initials confirmed, starting countdown...\n");
+  mp_sync_ready(MP_PHASE_COUNTDOWN);
+  set_game_state(STATE_SP_COUNTDOWN);
+}
+
+static void initials_tick() {
+  update_mp_game();
+  
+  /* Only the blinking cursor changes on its own */
+  if (game_update_initials_cursor(get_current_game())) {
+    request_page_redraw();
+  }
+}
+
+static void initials_key(uint8_t scancode) {
+  int kb_result = handle_initials_keyboard(scancode);
+
+  if (kb_result == 1) {
+    initials_confirmed();
+  } else if (kb_result == 0) {
+    /* Character changed */
+    request_page_redraw();
+  }
+}
+
+static void initials_mouse(struct packet *pp) {
+  menu_page_mouse_moved();
+
+  if (pp->lb && handle_initials_click(mouse_get_x(), mouse_get_y(), true) == 1) {
+    /* Done button clicked (only enabled with valid initials) */
+    initials_confirmed();
+  }
+}
+
+static int initials_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_enter_initials_page(mouse_x, mouse_y);
+}
+
+/* ---------- Countdown ---------- */
+
+static void countdown_enter(game_state_t from) {
+  jogo_t *game = get_current_game();
+  game_start_countdown(game);
+  game->start_pending = is_in_multiplayer_mode();
+}
+
+static void countdown_tick() {
+  jogo_t *game = get_current_game();
+  uint8_t last_countdown_value = game->countdown;
+  
+  /* 2 player mode: the countdown runs from the shared start time, so letter rain begins together */
+  update_mp_game();
+  if (game->start_pending) {
+    uint64_t start = mp_sync_start_ns(MP_PHASE_COUNTDOWN);
+    if (start == 0) return;
+    game->phase_start_ns = start;
+    game->start_pending = false;
+    request_page_redraw();
+  }
+
+  if (game_update_countdown(game)) {
+    printf("Countdown finished, starting letter rain...\n");
+    set_game_state(STATE_SP_LETTER_RAIN);
+  } else if (last_countdown_value != game->countdown) {
+    /* Redraw countdown only if number changed */
+    request_page_redraw();
+  }
+}
+
+static void countdown_key(uint8_t scancode) {
+  if (scancode == ENTER_MAKE && !is_in_multiplayer_mode()) {
+    /* Enter pressed during countdown - skip to letter rain (not in 2 player mode, it starts together) */
+    printf("Enter pressed, skipping countdown...\n");
+    set_game_state(STATE_SP_LETTER_RAIN);
+  } else if (scancode == T_MAKE && !is_in_multiplayer_mode()) {
+    /* Single player only: both players of a 2 player game must get the same rain */
+    jogo_t *game = get_current_game();
+    game->storm_mode = !game->storm_mode;
+    printf("Letter storm %s\n", game->storm_mode ? "on" : "off");
+    request_page_redraw();
+  }
+}
+
+static int countdown_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return draw_countdown_page(); /* No mouse support */
+}
+
+/* ---------- Letter rain ---------- */
+
+static void letter_rain_enter(game_state_t from) {
+  jogo_t *game = get_current_game();
+
+  if (game_start_letter_rain(game) != 0) {
+    printf("Error starting letter rain, using fallback\n");
+    game->state = GAME_STATE_LETTER_RAIN;
+  }
+}
+
+static void letter_rain_exit(game_state_t to) {
+  /* Sprites are owned by the letter rain state, whatever the way out */
+  game_cleanup_letter_rain(get_current_game());
+}
+
+static void letter_rain_tick() {
+  jogo_t *game = get_current_game();
+  update_mp_game();
+
+  if (game_update_letter_rain(game) == 1) {
+    /* Letter rain finished */
+    if (game->letra != 0) {
+      printf("Letter rain finished, caught letter: %c\n", game->letra);
+      set_game_state(STATE_SP_PLAYING);
+    } else {
+      printf("Letter rain failed\n");
+      set_game_state(STATE_MAIN_MENU);
+    }
+  }
+}
+
+static void letter_rain_key(uint8_t scancode) {
+  jogo_t *game = get_current_game();
+
+  if (scancode == ENTER_MAKE) {
+    /* Enter pressed - skip letter rain */
+    printf("Enter pressed, skipping letter rain...\n");
+
+    if (game->letra == 0) {
+      game->letra = 'A';
+      printf("Using default letter 'A'\n");
+    }
+
+    set_game_state(STATE_SP_PLAYING);
+  } else {
+    /* Normal letter rain input (marks the page dirty if the board moved) */
+    game_handle_letter_rain_input(game, scancode);
+  }
+}
+
+static int letter_rain_draw_page(uint16_t mouse_x, uint16_t mouse_y) {
+  return game_draw_letter_rain(get_current_game()); /* No mouse support */
+}
+
+/* ---------- Word phase ---------- */
+
+static void sp_playing_enter(game_state_t from) {
+  /* Starts the word phase with the letter caught in the letter rain */
+  get_singleplayer_game();
+}
+
+static void sp_playing_tick() {
+  singleplayer_game_t *game = get_singleplayer_game();
+  update_mp_game();
+  
+  /* 2 player mode: both word phases open at the shared start time, their timers run from it */
+  if (game->start_pending) {
+    uint64_t start = mp_sync_start_ns(MP_PHASE_WORDS);
+    if (start != 0 && hrclock_now_ns() >= start) singleplayer_start_playing(game, start);
+  }
+  
+  if (singleplayer_update(game) == 1 && is_in_multiplayer_mode()) {
+    printf("Multiplayer mode: transitioning to waiting screen\n");
+    set_game_state(STATE_MP_WAITING_FOR_OTHER_PLAYER);
+  }
+  /* Single player: stays in results state until ESC is pressed */
+}
+
+static void sp_playing_key(uint8_t scancode) {
+  singleplayer_game_t *game = get_singleplayer_game();
+  
+  /* 2 player mode: ENTER on the category page waits for the other player */
+  if (is_in_multiplayer_mode() && game->state == SP_STATE_STARTING) {
+    if (scancode == ENTER_MAKE && !game->start_pending) {
+      game->start_pending = true;
+      mp_sync_ready(MP_PHASE_WORDS);
+      request_page_redraw();
+    }
+    return;
+  }
+  
+  /* Marks the page dirty when the input box changes */
+  singleplayer_handle_input(game, scancode);
+  send_mp_progress(); /* An accepted word reaches the other player right away */
+}
+
+static int sp_playing_draw(uint16_t mouse_x, uint16_t mouse_y) {
+  return singleplayer_draw(get_singleplayer_game());
+}
+
+/* The game states are shared with 2 player mode, where the link keeps being served */
+static void mp_game_serial() {
+  receive_mp_game();
+}
+
+/* ---------- Handler table ---------- */
+
+static const state_handler_t state_handlers[STATE_COUNT] = {
+  /*                                    name              on_enter               on_exit           on_tick                on_key            on_mouse            on_serial                draw                    tick_hz */
+  [STATE_MAIN_MENU]                   = {"MAIN_MENU",       main_menu_enter,       NULL,             NULL,                  NULL,             main_menu_mouse,    NULL,                    main_menu_draw,         TICK_HZ_IDLE},
+  [STATE_SINGLE_PLAYER]               = {"SINGLE_PLAYER",   single_player_enter,   NULL,             NULL,                  NULL,             NULL,               NULL,                    single_player_draw,     TICK_HZ_IDLE},
+  [STATE_MULTIPLAYER]                 = {"MULTIPLAYER",     multiplayer_enter,     NULL,             NULL,                  NULL,             NULL,               NULL,                    multiplayer_draw,       TICK_HZ_IDLE},
+  [STATE_MULTIPLAYER_TEST]            = {"MP_TEST",         multiplayer_test_enter, NULL,            multiplayer_test_tick, NULL,             NULL,               multiplayer_test_serial, multiplayer_test_draw,  TICK_HZ_MEDIUM},
+  [STATE_MP_WAITING_FOR_OTHER_PLAYER] = {"MP_WAITING",      mp_waiting_enter,      NULL,             mp_waiting_tick,       NULL,             NULL,               mp_waiting_serial,       mp_waiting_draw,        TICK_HZ_MEDIUM},
+  [STATE_MP_RESULTS]                  = {"MP_RESULTS",      NULL,                  NULL,             NULL,                  NULL,             NULL,               mp_results_serial,       mp_results_draw,        TICK_HZ_IDLE},
+  [STATE_LEADERBOARD]                 = {"LEADERBOARD",     NULL,                  NULL,             NULL,                  NULL,             leaderboard_mouse,  NULL,                    leaderboard_draw,       TICK_HZ_IDLE},
+  [STATE_INSTRUCTIONS]                = {"INSTRUCTIONS",    NULL,                  NULL,             NULL,                  NULL,             instructions_mouse, NULL,                    instructions_draw,      TICK_HZ_IDLE},
+  [STATE_SP_ENTER_INITIALS]           = {"SP_INITIALS",     NULL,                  NULL,             initials_tick,         initials_key,     initials_mouse,     mp_game_serial,          initials_draw,          TICK_HZ_IDLE},
+  [STATE_SP_COUNTDOWN]                = {"SP_COUNTDOWN",    countdown_enter,       NULL,             countdown_tick,        countdown_key,    NULL,               mp_game_serial,          countdown_draw,         TICK_HZ_HIGH},
+  [STATE_SP_LETTER_RAIN]              = {"SP_LETTER_RAIN",  letter_rain_enter,     letter_rain_exit, letter_rain_tick,      letter_rain_key,  NULL,               mp_game_serial,          letter_rain_draw_page,  TICK_HZ_HIGH},
+  [STATE_SP_PLAYING]                  = {"SP_PLAYING",      sp_playing_enter,      NULL,             sp_playing_tick,       sp_playing_key,   NULL,               mp_game_serial,          sp_playing_draw,        TICK_HZ_MEDIUM},
+};
+
+/* ---------- Dispatch ---------- */
+
+/* Reprogram timer 0 only when the rate actually changes */
+static void set_tick_rate(uint32_t hz) {
+#ifdef FIXED_TICK_RATE
+  hz = DEFAULT_TICK_HZ; /* Build with -DFIXED_TICK_RATE to measure the baseline */
+#endif
+  if (hz == 0 || hz == tick_hz) return;
+
+  if (timer_set_frequency(0, hz) != 0) {
+    printf("set_tick_rate(): failed to set timer 0 to %u Hz\n", hz);
+    return;
+  }
+  tick_hz = hz;
+  hrclock_set_tick_rate(hz);
+  last_tick_ns = 0; /* The next frame delta would span two rates */
+}
+
+game_state_t get_game_state() {
+  return current_state;
+}
+
+void set_game_state(game_state_t state) {
+  if (state >= STATE_COUNT) {
+    printf("set_game_state(): invalid state %d\n", state);
+    return;
+  }
+
+  page_dirty = true; /* A new state always means a new page */
+  set_tick_rate(state_handlers[state].tick_hz); /* Also programs the initial state's rate */
+  if (state == current_state) return;
+
+  game_state_t from = current_state;
+  printf("State %s -> %s\n", state_handlers[from].name, state_handlers[state].name);
+
+  /* Allocations of the whole transition are setup, not steady-state work */
+  if (transition_depth++ == 0) {
+    state_stats[from].allocs += alloc_stats()->allocs - allocs_mark;
+  }
+
+  if (state_handlers[from].on_exit != NULL) {
+    state_handlers[from].on_exit(state);
+  }
+
+  uint64_t now = hrclock_now_ns();
+  state_stats[from].time_ns += now - state_entered_ns;
+  state_entered_ns = now;
+
+  current_state = state;
+  ticks_in_state = 0;
+  state_stats[state].entries++;
+
+  for (int i = 0; i < transition_hook_count; i++) {
+    transition_hooks[i](from, state);
+  }
+
+  /* May transition again (e.g. transient setup states) */
+  if (state_handlers[state].on_enter != NULL) {
+    state_handlers[state].on_enter(from);
+  }
+
+  if (--transition_depth == 0) {
+    allocs_mark = alloc_stats()->allocs;
+  }
+}
+
+int states_add_transition_hook(state_transition_hook_t hook) {
+  if (hook == NULL || transition_hook_count >= MAX_TRANSITION_HOOKS) return 1;
+
+  transition_hooks[transition_hook_count++] = hook;
+  return 0;
+}
+
+void states_tick() {
+  uint64_t now = hrclock_now_ns();
+  frame_dt_ns = last_tick_ns != 0 ? now - last_tick_ns : 0;
+  last_tick_ns = now;
+
+  ticks_in_state++;
+  state_stats[current_state].ticks++;
+
+  if (state_handlers[current_state].on_tick != NULL) {
+    state_handlers[current_state].on_tick();
+  }
+}
+
+void states_key(uint8_t scancode) {
+  state_stats[current_state].events++;
+
+  /* ESC always goes back to the main menu, or quits from it */
+  if (scancode == ESC_MAKE) {
+    printf("ESC key pressed in state: %s\n", state_handlers[current_state].name);
+    if (current_state == STATE_MAIN_MENU) {
+      states_request_quit();
+    } else {
+      set_game_state(STATE_MAIN_MENU);
+    }
+    return;
+  }
+
+  if (state_handlers[current_state].on_key != NULL) {
+    state_handlers[current_state].on_key(scancode);
+  }
+}
+
+void states_mouse(struct packet *pp) {
+  state_stats[current_state].events++;
+
+  if (state_handlers[current_state].on_mouse != NULL) {
+    state_handlers[current_state].on_mouse(pp);
+  } else {
+    /* Mouse is ignored during gameplay, don't let its movement leak into the next page */
+    mouse_clear_redraw_flag();
+    mouse_clear_page_redraw_flag();
+  }
+}
+
+void states_serial() {
+  if (state_handlers[current_state].on_serial != NULL) {
+    state_stats[current_state].events++;
+    state_handlers[current_state].on_serial();
+  }
+}
+
+void request_page_redraw() {
+  page_dirty = true;
+}
+
+bool page_redraw_requested() {
+  return page_dirty;
+}
+
+void clear_page_redraw_request() {
+  page_dirty = false;
+}
+
+int draw_current_page(uint16_t mouse_x, uint16_t mouse_y) {
+  state_stats[current_state].draws++;
+  return state_handlers[current_state].draw(mouse_x, mouse_y);
+}
+
+void states_request_quit() {
+  quit_requested = true;
+}
+
+bool states_quit_requested() {
+  return quit_requested;
+}
+
+uint32_t states_ticks_in_state() {
+  return ticks_in_state;
+}
+
+uint64_t states_ns_in_state() {
+  return hrclock_elapsed_ns(state_entered_ns);
+}
+
+uint64_t states_frame_dt_ns() {
+  return frame_dt_ns;
+}
+
+void states_add_busy_ns(uint64_t ns) {
+  state_stats[current_state].busy_ns += ns;
+}
+
+uint32_t states_tick_rate() {
+  return tick_hz;
+}
+
+void states_restore_tick_rate() {
+  if (tick_hz != DEFAULT_TICK_HZ && timer_set_frequency(0, DEFAULT_TICK_HZ) == 0) {
+    tick_hz = DEFAULT_TICK_HZ;
+    hrclock_set_tick_rate(DEFAULT_TICK_HZ);
+  }
+}
+
+const state_stats_t *states_get_stats(game_state_t state) {
+  if (state >= STATE_COUNT) return NULL;
+  return &state_stats[state];
+}
+
+void states_print_stats() {
+  printf("=== State statistics ===\n");
+  printf("%-16s %6s %8s %8s %8s %8s %10s %10s %6s %7s\n", "state", "hz", "entries", "ticks", "events",
+         "draws", "time_ms", "busy_ms", "cpu%", "allocs");
+  for (int i = 0; i < STATE_COUNT; i++) {
+    uint64_t time_ns = state_stats[i].time_ns;
+    if (i == (int) current_state) time_ns += states_ns_in_state();
+    uint64_t busy_ns = state_stats[i].busy_ns;
+    uint32_t allocs = state_stats[i].allocs;
+    if (i == (int) current_state) allocs += alloc_stats()->allocs - allocs_mark;
+    /* Tenths of a percent of the state's wall time spent awake */
+    uint64_t cpu = time_ns > 0 ? busy_ns * 1000 / time_ns : 0;
+    printf("%-16s %6u %8u %8u %8u %8u %10llu %10llu %4llu.%llu %7u\n", state_handlers[i].name,
+           state_handlers[i].tick_hz, state_stats[i].entries, state_stats[i].ticks, state_stats[i].events,
+           state_stats[i].draws, (unsigned long long) (time_ns / NS_PER_MS),
+           (unsigned long long) (busy_ns / NS_PER_MS), (unsigned long long) (cpu / 10),
+           (unsigned long long) (cpu % 10), allocs);
+  }
+}
@@ -0,0 +1,201 @@
+#ifndef _STATES_H_
+#define _STATES_H_
+
+#include <lcom/lcf.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Game states */
+typedef enum {
+  STATE_MAIN_MENU,
+  STATE_SINGLE_PLAYER,
+  STATE_MULTIPLAYER,
+  STATE_MULTIPLAYER_TEST,
+  STATE_MP_WAITING_FOR_OTHER_PLAYER,
+  STATE_MP_RESULTS,
+  STATE_LEADERBOARD,
+  STATE_INSTRUCTIONS,
+  STATE_SP_ENTER_INITIALS,
+  STATE_SP_COUNTDOWN,
+  STATE_SP_LETTER_RAIN,
+  STATE_SP_PLAYING,
+  STATE_COUNT          /* Number of states (size of the handler table) */
+} game_state_t;
+
+/* Timer 0 rates (i8254 minimum is 19 Hz) */
+#define DEFAULT_TICK_HZ 60  /* LCF default, restored on exit */
+#define TICK_HZ_IDLE 20     /* Static pages: menus, instructions, leaderboard, results */
+#define TICK_HZ_MEDIUM 30   /* Word phase and serial polling */
+#define TICK_HZ_HIGH 120    /* Letter rain (one interrupt per simulation step) and the countdown before it */
+
+/**
+ * @brief Per-state handlers, any of them may be NULL
+ */
+typedef struct {
+  const char *name;                             /* State name for logs and statistics */
+  void (*on_enter)(game_state_t from);          /* Set up resources owned by the state */
+  void (*on_exit)(game_state_t to);             /* Release resources owned by the state */
+  void (*on_tick)();                            /* Timer interrupt */
+  void (*on_key)(uint8_t scancode);             /* Keyboard scancode (ESC is handled by the dispatcher) */
+  void (*on_mouse)(struct packet *pp);          /* Complete mouse packet */
+  void (*on_serial)();                          /* Serial link may have data */
+  int (*draw)(uint16_t mouse_x, uint16_t mouse_y); /* Draw the whole page */
+  uint32_t tick_hz;                             /* Timer 0 rate while in the state */
+} state_handler_t;
+
+/**
+ * @brief Per-state timing counters
+ */
+typedef struct {
+  uint32_t entries;  /* Times the state was entered */
+  uint32_t ticks;    /* Timer interrupts handled in the state */
+  uint32_t events;   /* Keyboard, mouse and serial events handled in the state */
+  uint32_t draws;    /* Pages drawn in the state */
+  uint64_t time_ns;  /* Real time spent in the state (completed visits) */
+  uint64_t busy_ns;  /* Part of that time spent handling events and drawing */
+  uint32_t allocs;   /* Heap allocations while in the state, outside on_enter/on_exit */
+} state_stats_t;
+
+/**
+ * @brief Function called on every state transition (after on_exit, before on_enter)
+ */
+typedef void (*state_transition_hook_t)(game_state_t from, game_state_t to);
+
+/**
+ * @brief Get current game state
+ *
+ * @return Current game state
+ */
+game_state_t get_game_state();
+
+/**
+ * @brief Set game state, running the on_exit/on_enter handlers and transition hooks
+ *
+ * @param state New game state
+ */
+void set_game_state(game_state_t state);
+
+/**
+ * @brief Register a function to be called on every state transition
+ *
+ * @param hook Function to call
+ * @return 0 on success, non-zero if there is no room for more hooks
+ */
+int states_add_transition_hook(state_transition_hook_t hook);
+
+/**
+ * @brief Dispatch a timer interrupt to the current state
+ */
+void states_tick();
+
+/**
+ * @brief Dispatch a keyboard scancode to the current state (ESC goes back/quits)
+ *
+ * @param scancode Keyboard scancode
+ */
+void states_key(uint8_t scancode);
+
+/**
+ * @brief Dispatch a complete mouse packet to the current state
+ *
+ * @param pp Mouse packet
+ */
+void states_mouse(struct packet *pp);
+
+/**
+ * @brief Let the current state process data available on the serial link
+ */
+void states_serial();
+
+/**
+ * @brief Mark the current page as dirty so the main loop redraws it
+ */
+void request_page_redraw();
+
+/**
+ * @brief Check if the current page has to be redrawn
+ *
+ * @return True if something visible changed since the last draw
+ */
+bool page_redraw_requested();
+
+/**
+ * @brief Clear the page redraw request (called right before drawing)
+ */
+void clear_page_redraw_request();
+
+/**
+ * @brief Draw current page based on game state
+ *
+ * @param mouse_x Current mouse X position
+ * @param mouse_y Current mouse Y position
+ * @return 0 on success, non-zero otherwise
+ */
+int draw_current_page(uint16_t mouse_x, uint16_t mouse_y);
+
+/**
+ * @brief Ask the main loop to exit
+ */
+void states_request_quit();
+
+/**
+ * @brief Check if quitting the application was requested
+ *
+ * @return True if the main loop should exit
+ */
+bool states_quit_requested();
+
+/**
+ * @brief Get the number of timer interrupts since the current state was entered
+ *
+ * @return Ticks in the current state
+ */
+uint32_t states_ticks_in_state();
+
+/**
+ * @brief Get the real time since the current state was entered
+ *
+ * @return Nanoseconds in the current state
+ */
+uint64_t states_ns_in_state();
+
+/**
+ * @brief Get the real time between the last two timer interrupts
+ *
+ * @return Frame delta in nanoseconds (0 before the second interrupt)
+ */
+uint64_t states_frame_dt_ns();
+
+/**
+ * @brief Account time the main loop spent awake (handling events and drawing)
+ *
+ * @param ns Nanoseconds to charge to the current state
+ */
+void states_add_busy_ns(uint64_t ns);
+
+/**
+ * @brief Get the timer 0 rate currently programmed
+ *
+ * @return Timer interrupts per second
+ */
+uint32_t states_tick_rate();
+
+/**
+ * @brief Put timer 0 back at DEFAULT_TICK_HZ (call before exiting)
+ */
+void states_restore_tick_rate();
+
+/**
+ * @brief Get the timing counters of a state
+ *
+ * @param state Game state
+ * @return Pointer to the counters, NULL if the state is invalid
+ */
+const state_stats_t *states_get_stats(game_state_t state);
+
+/**
+ * @brief Print the timing counters of every state
+ */
+void states_print_stats();
+
+#endif /* _STATES_H_ */
@@ -0,0 +1,91 @@
+/*
+ * Host tool: converts the categories in dicionarios.h into the dictionary
+ * image the game uses (see dictionary.h).
+ *
+ * Usage: dict_convert [-c] [output]
+ *   default  binary image, mapped at startup (../dicionario.bin)
+ *   -c       C source with the built-in image (../dictionary_data.c)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dicionarios.h"
+#include "dictionary.h"
+#include "dictionary_build.h"
+
+static const char *category_name(int c) {
+  return categorias[c].nome;
+}
+
+static int category_words(int c) {
+  return categorias[c].totalPontuacoes;
+}
+
+static const char *category_word(int c, int w, int *score) {
+  *score = categorias[c].pontuacoes[w].pontuacao;
+  return categorias[c].pontuacoes[w].palavra;
+}
+
+/* The image as a uint32_t array so the object file keeps it 4-byte aligned */
+static int write_source(FILE *f, const void *image, size_t size) {
+  const uint32_t *words = image;
+  size_t count = size / 4;
+
+  fprintf(f, "/* Generated by tools/dict_convert from dicionarios.h - do not edit */\n");
+  fprintf(f, "#include \"dictionary.h\"\n\n");
+  fprintf(f, "const uint32_t dictionary_data[%u] = {\n", (unsigned) count);
+  for (size_t i = 0; i < count; i++) {
+    fprintf(f, "%s0x%08x,%s", i % 8 == 0 ? "  " : "", words[i], i % 8 == 7 || i + 1 == count ? "\n" : " ");
+  }
+  fprintf(f, "};\n\n");
+  fprintf(f, "const size_t dictionary_data_size = %u;\n", (unsigned) size);
+  return ferror(f) ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+  int source = argc > 1 && strcmp(argv[1], "-c") == 0;
+  const char *path = argc > 1 + source ? argv[1 + source] : source ? "../dictionary_data.c" : "../" DICT_FILE;
+
+  size_t size = 0;
+  void *image = dictionary_build(TOTAL_CATEGORIAS, category_name, category_words, category_word, &size);
+  if (image == NULL) {
+    printf("dict_convert: failed to build the dictionary\n");
+    return 1;
+  }
+
+  /* Read the image back the way the game will */
+  if (dictionary_use_image(image, size) != 0) {
+    printf("dict_convert: built image does not validate\n");
+    free(image);
+    return 1;
+  }
+  const dict_header_t *h = image;
+
+  FILE *f = fopen(path, source ? "w" : "wb");
+  int failed = f == NULL;
+  if (!failed) failed = source ? write_source(f, image, size) : fwrite(image, 1, size, f) != size;
+  if (f != NULL && fclose(f) != 0) failed = 1;
+  if (failed) {
+    printf("dict_convert: cannot write %s\n", path);
+    free(image);
+    return 1;
+  }
+
+  /* Resident size report: the old tables were a static array in a header,
+   * one writable copy per translation unit that kept it */
+  size_t strings = 0, text = 0;
+  for (int c = 0; c < TOTAL_CATEGORIAS; c++) {
+    strings += strlen(categorias[c].nome) + 1;
+    for (int w = 0; w < categorias[c].totalPontuacoes; w++) {
+      text += strlen(categorias[c].pontuacoes[w].palavra) + 1;
+    }
+  }
+  printf("%s: %u categories, %u words\n", path, h->category_count, h->word_count);
+  printf("  before: %6u bytes per copy of dicionarios.h (%u bytes of text, words stored twice)\n",
+         (unsigned) sizeof(categorias), (unsigned) (strings + 2 * text));
+  printf("  after:  %6u bytes, one read-only image (%u header+tables, %u string pool)\n",
+         h->file_size, h->pool_offset, h->pool_size);
+
+  free(image);
+  return 0;
+}
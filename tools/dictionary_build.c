@@ -0,0 +1,156 @@
+#include "dictionary_build.h"
+#include "dictionary.h"
+#include "gameLogic.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* String pool with a hash table of offsets so every distinct string is stored once */
+typedef struct {
+  char *data;
+  size_t size, cap;
+  uint32_t *slots;   /* offset + 1 of the string in each slot, 0 if empty */
+  size_t slot_count; /* Power of two */
+  size_t used;
+} pool_t;
+
+static uint32_t hash_string(const char *s) {
+  uint32_t h = 2166136261u; /* FNV-1a */
+  for (; *s; s++) {
+    h ^= (unsigned char) *s;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static int pool_grow_slots(pool_t *p) {
+  size_t count = p->slot_count ? p->slot_count * 2 : 1024;
+  uint32_t *slots = calloc(count, sizeof(uint32_t));
+  if (slots == NULL) return 1;
+
+  for (size_t i = 0; i < p->slot_count; i++) {
+    if (p->slots[i] == 0) continue;
+    size_t j = hash_string(p->data + p->slots[i] - 1) & (count - 1);
+    while (slots[j] != 0) j = (j + 1) & (count - 1);
+    slots[j] = p->slots[i];
+  }
+
+  free(p->slots);
+  p->slots = slots;
+  p->slot_count = count;
+  return 0;
+}
+
+/* Offset of s in the pool, adding it if it is new. UINT32_MAX on error */
+static uint32_t pool_intern(pool_t *p, const char *s) {
+  if (p->used * 2 >= p->slot_count && pool_grow_slots(p) != 0) return UINT32_MAX;
+
+  size_t j = hash_string(s) & (p->slot_count - 1);
+  while (p->slots[j] != 0) {
+    if (strcmp(p->data + p->slots[j] - 1, s) == 0) return p->slots[j] - 1;
+    j = (j + 1) & (p->slot_count - 1);
+  }
+
+  size_t len = strlen(s) + 1;
+  if (p->size + len > p->cap) {
+    size_t cap = p->cap ? p->cap * 2 : 4096;
+    while (cap < p->size + len) cap *= 2;
+    char *data = realloc(p->data, cap);
+    if (data == NULL) return UINT32_MAX;
+    p->data = data;
+    p->cap = cap;
+  }
+  if (p->size + len > UINT32_MAX) return UINT32_MAX;
+
+  uint32_t offset = (uint32_t) p->size;
+  memcpy(p->data + p->size, s, len);
+  p->size += len;
+  p->slots[j] = offset + 1;
+  p->used++;
+  return offset;
+}
+
+void *dictionary_build(int count, const char *(*name)(int c), int (*words)(int c),
+                       const char *(*word)(int c, int w, int *score), size_t *size) {
+  if (count <= 0) return NULL;
+
+  size_t word_count = 0;
+  for (int c = 0; c < count; c++) {
+    int n = words(c);
+    if (n < 0 || n > DICT_MAX_CATEGORY_WORDS) {
+      printf("dictionary_build(): category %d has %d words\n", c, n);
+      return NULL;
+    }
+    word_count += (size_t) n;
+  }
+
+  dict_category_t *cats = calloc((size_t) count, sizeof(dict_category_t));
+  dict_word_t *table = calloc(word_count ? word_count : 1, sizeof(dict_word_t));
+  pool_t pool = {0};
+  void *image = NULL;
+  if (cats == NULL || table == NULL) goto done;
+
+  size_t next = 0;
+  for (int c = 0; c < count; c++) {
+    cats[c].name = pool_intern(&pool, name(c));
+    cats[c].first_word = (uint32_t) next;
+    cats[c].word_count = (uint32_t) words(c);
+    if (cats[c].name == UINT32_MAX) goto done;
+
+    for (uint32_t w = 0; w < cats[c].word_count; w++, next++) {
+      int score = 0;
+      const char *text = word(c, (int) w, &score);
+
+      /* Normalized key: lowercase without accents, the form input is compared in */
+      char key[MAX_ENTRADA];
+      strncpy(key, text, MAX_ENTRADA);
+      key[MAX_ENTRADA - 1] = '\0';
+      for (int i = 0; key[i]; i++) key[i] = (char) tolower((unsigned char) key[i]);
+      removerAcentos(key);
+
+      size_t key_len = strlen(key);
+      if (key_len == 0 || key_len > DICT_MAX_KEY || score < 0 || score > UINT16_MAX) {
+        printf("dictionary_build(): invalid word '%s' in category %d\n", text, c);
+        goto done;
+      }
+
+      table[next].text = pool_intern(&pool, text);
+      table[next].key = pool_intern(&pool, key);
+      table[next].letters = mascaraLetras(key);
+      table[next].score = (uint16_t) score;
+      table[next].key_len = (uint8_t) key_len;
+      if (table[next].text == UINT32_MAX || table[next].key == UINT32_MAX) goto done;
+    }
+  }
+
+  /* Pool is padded so the image size stays a multiple of 4 */
+  size_t pool_size = (pool.size + 3) & ~(size_t) 3;
+  dict_header_t header = {0};
+  header.magic = DICT_MAGIC;
+  header.version = DICT_VERSION;
+  header.category_count = (uint32_t) count;
+  header.word_count = (uint32_t) word_count;
+  header.categories_offset = sizeof(dict_header_t);
+  header.words_offset = header.categories_offset + (uint32_t) (count * sizeof(dict_category_t));
+  header.pool_offset = header.words_offset + (uint32_t) (word_count * sizeof(dict_word_t));
+  header.pool_size = (uint32_t) pool_size;
+  header.file_size = header.pool_offset + header.pool_size;
+
+  image = calloc(1, header.file_size);
+  if (image == NULL) goto done;
+
+  uint8_t *out = image;
+  memcpy(out, &header, sizeof(header));
+  memcpy(out + header.categories_offset, cats, count * sizeof(dict_category_t));
+  memcpy(out + header.words_offset, table, word_count * sizeof(dict_word_t));
+  memcpy(out + header.pool_offset, pool.data, pool.size);
+  *size = header.file_size;
+
+done:
+  free(cats);
+  free(table);
+  free(pool.data);
+  free(pool.slots);
+  return image;
+}
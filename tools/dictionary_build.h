@@ -0,0 +1,19 @@
+#ifndef _DICTIONARY_BUILD_H_
+#define _DICTIONARY_BUILD_H_
+
+#include <stddef.h>
+
+/**
+ * @brief Serialize categories into a new image, interning every string once
+ *
+ * @param count Number of categories
+ * @param name Returns the name of category c
+ * @param words Returns the number of words of category c
+ * @param word Returns word w of category c and stores its score
+ * @param size Returns the image size in bytes
+ * @return Image allocated with malloc (caller frees), NULL on error
+ */
+void *dictionary_build(int count, const char *(*name)(int c), int (*words)(int c),
+                       const char *(*word)(int c, int w, int *score), size_t *size);
+
+#endif /* _DICTIONARY_BUILD_H_ */
@@ -0,0 +1,496 @@
+/*
+ * Serial link simulator: two headless multiplayer peers, each running the
+ * game's serial rings, protocol, reliable layer and 2 player session
+ * (multiplayer.c, with the game's handler tables) in its own process, talk
+ * through a simulated cable (a socketpair per peer, relayed by this process)
+ * that throttles to a baud rate and adds latency, jitter, corrupted and
+ * dropped bytes. Each peer's clock runs at its own random offset. Every run
+ * goes through the flows of a 2 player game:
+ *
+ *   connect  CONNECT both ways and clock sync, until the handshake completes
+ *   ready    READY after a random delay (a player entering initials), until the shared start is known
+ *   start    how far apart the two peers actually started, on the real clock
+ *   play     PROGRESS at the game's rate (unreliable: one-way latency and loss)
+ *   finish   GAME_FINISHED both ways, until the other player's arrived
+ *   confirm  until our GAME_FINISHED was acknowledged
+ *
+ * The peers wait for each other between runs, still answering on the link.
+ *
+ * Usage: link_sim [-r runs] [-b baud] [-l latency_ms] [-j jitter_ms] [-c corrupt_rate]
+ *                 [-d drop_rate] [-p play_ms] [-t timeout_ms] [-s seed] [-T] [-v]
+ *        -b 0 does not throttle, -T saves link_sim_A.bin / link_sim_B.bin traces, -v shows peer logs
+ */
+#define _GNU_SOURCE /* ppoll */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include "serial.h"
+#include "serial_pty.h"
+#include "protocol.h"
+#include "reliable.h"
+#include "multiplayer.h"
+#include "trace.h"
+#include "rng.h"
+
+#define PEERS 2
+#define LINE_SIZE 65536              /* Bytes on the simulated cable per direction */
+#define MAX_READY_DELAY_MS 300       /* Players get ready up to this far apart */
+#define MAX_CLOCK_OFFSET_S 1000      /* Peer clocks differ by up to this much */
+#define TICK_NS (1000000000ULL / 30) /* The game's TICK_HZ_MEDIUM, its tick rate while connecting */
+
+/* Link parameters */
+static int runs = 20;
+static uint32_t baud = 115200;
+static uint64_t latency_ns = 0;
+static uint64_t jitter_ns = 0;
+static double corrupt_rate = 0;
+static double drop_rate = 0;
+static uint64_t play_ns = 500 * 1000000ULL;
+static uint64_t timeout_ns = 5000 * 1000000ULL;
+static uint64_t seed = 1;
+static bool tracing = false;
+static bool verbose = false;
+
+static uint64_t now_ns() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000ULL + (uint64_t) t.tv_nsec;
+}
+
+/* ---------- Peer to simulator reports ---------- */
+
+typedef enum { FLOW_CONNECT, FLOW_READY, FLOW_START, FLOW_FINISH, FLOW_CONFIRM, FLOW_PROGRESS, FLOW_COUNT } flow_t;
+static const char *flow_names[FLOW_COUNT] = {"connect", "ready", "start", "finish", "confirm", "progress"};
+
+typedef enum {
+  REPORT_FLOW,      /* flow, ok, value = completion time (us) */
+  REPORT_PROGRESS,  /* value = one-way latency of a received PROGRESS (us) */
+  REPORT_SENT,      /* value = PROGRESS frames sent in the run */
+  REPORT_START,     /* ok = started, value = start time on the real clock (us, wraps) */
+  REPORT_DONE,      /* Run over, waiting for the other peer */
+  REPORT_STATS      /* flow = counter (see stat_names), value */
+} report_kind_t;
+
+typedef struct {
+  uint8_t kind;
+  uint8_t flow;
+  uint8_t ok;
+  uint8_t peer;
+  uint32_t value;
+} report_t;
+
+#define STAT_COUNT 4
+static const char *stat_names[STAT_COUNT] = {"retransmits", "duplicates", "CRC errors", "skipped bytes"};
+
+/* ---------- Headless peer ---------- */
+
+static int peer_id;
+static int report_fd;
+static int go_fd;
+static uint64_t clock_offset_ns; /* This peer's clock minus the real one */
+
+static void report(report_kind_t kind, int flow, bool ok, uint32_t value) {
+  report_t r = {(uint8_t) kind, (uint8_t) flow, ok, (uint8_t) peer_id, value};
+  if (write(report_fd, &r, sizeof(r)) != sizeof(r)) exit(1);
+}
+
+/* The session's clock: the real clock (shared by both peers) at this peer's offset */
+uint64_t hrclock_now_ns() {
+  return now_ns() + clock_offset_ns;
+}
+
+/* Serve the link for up to a millisecond, like one pass of the game's main loop: frames are
+ * received as they come and the session advanced on timer ticks. The connection test's
+ * handlers are used until the handshake completes, then the game's */
+static void serve() {
+  static uint64_t next_tick_ns = 0;
+  struct pollfd fd = {serial_pty_fd(), POLLIN, 0};
+  poll(&fd, 1, 1);
+  serial_ih();
+
+  bool tick = now_ns() >= next_tick_ns;
+  if (tick) next_tick_ns = now_ns() + TICK_NS;
+
+  if (!mp_connected()) {
+    mp_receive_connecting();
+    if (tick) mp_update_connecting();
+    return;
+  }
+  uint32_t received = mp_receive_connected();
+  if (tick) mp_tick();
+
+  /* The score field carries the send time on the real clock, until GAME_FINISHED replaces it */
+  if ((received & (1u << MSG_PROGRESS)) && !mp_opponent_finished()) {
+    uint32_t sent_us = (uint32_t) mp_opponent()->score;
+    report(REPORT_PROGRESS, FLOW_PROGRESS, true, (uint32_t) (now_ns() / 1000) - sent_us);
+  }
+}
+
+static uint64_t ready_start_ns;
+
+static bool connect_done() {
+  return mp_connected();
+}
+
+static bool ready_done() {
+  return (ready_start_ns = mp_sync_start_ns(MP_PHASE_COUNTDOWN)) != 0;
+}
+
+static bool finish_done() {
+  return mp_opponent_finished();
+}
+
+static bool confirm_done() {
+  return mp_all_delivered();
+}
+
+/* Serve until the flow is done or times out, and report it */
+static bool run_flow(flow_t flow, bool (*done)(), uint64_t start) {
+  bool ok;
+  while (!(ok = done()) && now_ns() - start < timeout_ns) serve();
+  report(REPORT_FLOW, flow, ok, (uint32_t) ((now_ns() - start) / 1000));
+  return ok;
+}
+
+/* One 2 player game; returns whether the shared start was reached, with its real time */
+static bool peer_run(rng_t *rng, uint64_t *started_ns) {
+  mp_reset();
+
+  /* connect: CONNECT and clock samples until the handshake completes */
+  uint64_t start = now_ns();
+  mp_send_connect();
+  if (!run_flow(FLOW_CONNECT, connect_done, start)) return false;
+
+  /* ready: the player gets ready a while later, then both start at the shared time */
+  uint64_t ready_at = now_ns() + rng_range(rng, MAX_READY_DELAY_MS) * 1000000ULL;
+  while (now_ns() < ready_at) serve();
+  start = now_ns();
+  mp_sync_ready(MP_PHASE_COUNTDOWN);
+  if (!run_flow(FLOW_READY, ready_done, start)) return false;
+  while (hrclock_now_ns() < ready_start_ns) serve();
+  *started_ns = now_ns();
+
+  /* play: PROGRESS stamped with the send time in the score field, words = frame number */
+  uint32_t sent = 0;
+  for (uint64_t play_start = now_ns(); now_ns() - play_start < play_ns; serve()) {
+    if (mp_send_progress("SIM", (int) (uint32_t) (now_ns() / 1000), (uint8_t) sent, 0)) sent++;
+  }
+  report(REPORT_SENT, FLOW_PROGRESS, true, sent);
+
+  /* finish and confirm, both timed from our GAME_FINISHED */
+  start = now_ns();
+  mp_send_finished("SIM", (int) rng_range(rng, 1000));
+  run_flow(FLOW_FINISH, finish_done, start);
+  run_flow(FLOW_CONFIRM, confirm_done, start);
+  return true;
+}
+
+static void peer_main(int id, int link_fd, int rep_fd, int go) {
+  peer_id = id;
+  report_fd = rep_fd;
+  go_fd = go;
+  if (!verbose && freopen("/dev/null", "w", stdout) == NULL) exit(1);
+
+  serial_pty_attach(link_fd);
+  if (serial_init() != 0) exit(1);
+  if (tracing) trace_start(now_ns);
+
+  rng_t rng;
+  rng_seed(&rng, seed, (uint64_t) id + 1);
+  clock_offset_ns = rng_range(&rng, MAX_CLOCK_OFFSET_S) * 1000000000ULL + rng_range(&rng, 1000000000);
+  fcntl(go_fd, F_SETFL, O_NONBLOCK);
+
+  for (int run = 0; run < runs; run++) {
+    /* Exactly one start report per run, so the simulator pairs the peers' starts */
+    uint64_t started_ns = 0;
+    bool started = peer_run(&rng, &started_ns);
+    report(REPORT_START, FLOW_START, started, (uint32_t) (started_ns / 1000));
+
+    /* Wait for the other peer, still acknowledging its retransmits */
+    report(REPORT_DONE, 0, true, 0);
+    char go_byte;
+    while (read(go_fd, &go_byte, 1) != 1) serve();
+  }
+
+  const rel_stats_t *rel = rel_stats();
+  const proto_stats_t *proto = proto_stats();
+  uint32_t stats[STAT_COUNT] = {rel->retransmits, rel->duplicates, proto->crc_errors, proto->skipped_bytes};
+  for (int i = 0; i < STAT_COUNT; i++) report(REPORT_STATS, i, true, stats[i]);
+
+  rel_print_stats();
+  if (tracing) {
+    trace_stop();
+    trace_save(id == 0 ? "link_sim_A.bin" : "link_sim_B.bin");
+  }
+  serial_cleanup();
+  exit(0);
+}
+
+/* ---------- Simulated cable ---------- */
+
+typedef struct {
+  int from, to;              /* Simulator ends of the two peers' socketpairs */
+  uint8_t data[LINE_SIZE];
+  uint64_t due[LINE_SIZE];   /* When each byte reaches the other peer */
+  uint32_t head, tail;
+  uint64_t wire_free_ns;     /* End of the last byte on the wire (throttling) */
+  uint64_t last_due_ns;      /* Bytes never overtake each other on a serial line */
+  uint32_t bytes, dropped, corrupted;
+} line_t;
+
+static line_t lines[PEERS];  /* lines[i] carries peer i's bytes to the other peer */
+static rng_t link_rng;
+
+static bool chance(double rate) {
+  return rate > 0 && rng_next(&link_rng) < rate * 4294967296.0;
+}
+
+/* Put a byte on the wire: 10 bit times at the baud rate (8N1), then the latency and jitter */
+static void line_send(line_t *line, uint8_t byte, uint64_t now) {
+  uint64_t depart = line->wire_free_ns > now ? line->wire_free_ns : now;
+  if (baud > 0) depart += 10 * 1000000000ULL / baud;
+  line->wire_free_ns = depart;
+  line->bytes++;
+
+  if (chance(drop_rate)) {
+    line->dropped++;
+    return;
+  }
+  if (chance(corrupt_rate)) {
+    byte ^= (uint8_t) (1u << rng_range(&link_rng, 8));
+    line->corrupted++;
+  }
+
+  uint64_t due = depart + latency_ns + (jitter_ns > 0 ? rng_range(&link_rng, (uint32_t) jitter_ns + 1) : 0);
+  if (due < line->last_due_ns) due = line->last_due_ns;
+  line->last_due_ns = due;
+
+  line->data[line->head % LINE_SIZE] = byte;
+  line->due[line->head % LINE_SIZE] = due;
+  line->head++;
+}
+
+static void line_read(line_t *line, uint64_t now) {
+  uint8_t buffer[4096];
+  uint32_t room = LINE_SIZE - (line->head - line->tail);
+  ssize_t n = read(line->from, buffer, room < sizeof(buffer) ? room : sizeof(buffer));
+  for (ssize_t i = 0; i < n; i++) line_send(line, buffer[i], now);
+}
+
+/* Hand the bytes that arrived over to the receiving peer */
+static void line_deliver(line_t *line, uint64_t now) {
+  while (line->tail != line->head && line->due[line->tail % LINE_SIZE] <= now) {
+    uint32_t start = line->tail % LINE_SIZE;
+    uint32_t count = 0;
+    while (line->tail + count != line->head && start + count < LINE_SIZE &&
+           line->due[start + count] <= now) count++;
+
+    ssize_t n = write(line->to, line->data + start, count);
+    if (n <= 0) return; /* Receiver busy, retried on the next pass */
+    line->tail += (uint32_t) n;
+  }
+}
+
+/* ---------- Results ---------- */
+
+typedef struct {
+  uint32_t *values;
+  uint32_t count, capacity;
+} samples_t;
+
+static void samples_add(samples_t *s, uint32_t value) {
+  if (s->count == s->capacity) {
+    s->capacity = s->capacity > 0 ? s->capacity * 2 : 256;
+    s->values = realloc(s->values, s->capacity * sizeof(uint32_t));
+    if (s->values == NULL) exit(1);
+  }
+  s->values[s->count++] = value;
+}
+
+static int compare_u32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+  return x < y ? -1 : x > y;
+}
+
+static void print_flow(const char *name, uint32_t attempted, samples_t *s) {
+  printf("%-10s %6u/%-6u %6.1f%%", name, s->count, attempted, attempted > 0 ? 100.0 * s->count / attempted : 0);
+  if (s->count > 0) {
+    qsort(s->values, s->count, sizeof(uint32_t), compare_u32);
+    printf(" %9.2f %9.2f %9.2f %9.2f", s->values[s->count / 2] / 1000.0, s->values[s->count * 9 / 10] / 1000.0,
+           s->values[s->count * 99 / 100] / 1000.0, s->values[s->count - 1] / 1000.0);
+  }
+  printf("\n");
+}
+
+static void usage() {
+  fprintf(stderr, "usage: link_sim [-r runs] [-b baud] [-l latency_ms] [-j jitter_ms] [-c corrupt_rate]\n"
+                  "                [-d drop_rate] [-p play_ms] [-t timeout_ms] [-s seed] [-T] [-v]\n");
+  exit(2);
+}
+
+int main(int argc, char *argv[]) {
+  int opt;
+  while ((opt = getopt(argc, argv, "r:b:l:j:c:d:p:t:s:Tv")) != -1) {
+    switch (opt) {
+      case 'r': runs = atoi(optarg); break;
+      case 'b': baud = (uint32_t) strtoul(optarg, NULL, 10); break;
+      case 'l': latency_ns = (uint64_t) (atof(optarg) * 1e6); break;
+      case 'j': jitter_ns = (uint64_t) (atof(optarg) * 1e6); break;
+      case 'c': corrupt_rate = atof(optarg); break;
+      case 'd': drop_rate = atof(optarg); break;
+      case 'p': play_ns = (uint64_t) (atof(optarg) * 1e6); break;
+      case 't': timeout_ns = (uint64_t) (atof(optarg) * 1e6); break;
+      case 's': seed = strtoull(optarg, NULL, 10); break;
+      case 'T': tracing = true; break;
+      case 'v': verbose = true; break;
+      default: usage();
+    }
+  }
+  if (runs < 1 || optind < argc) usage();
+  signal(SIGPIPE, SIG_IGN);
+  fflush(stdout);
+
+  /* One socketpair (link), report pipe and go pipe per peer */
+  int link[PEERS][2], reports[PEERS][2], go[PEERS][2];
+  pid_t pids[PEERS];
+  for (int i = 0; i < PEERS; i++) {
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, link[i]) != 0 || pipe(reports[i]) != 0 || pipe(go[i]) != 0) {
+      perror("link_sim");
+      return 1;
+    }
+  }
+  for (int i = 0; i < PEERS; i++) {
+    pids[i] = fork();
+    if (pids[i] < 0) {
+      perror("fork");
+      return 1;
+    }
+    if (pids[i] == 0) {
+      for (int j = 0; j < PEERS; j++) {
+        close(link[j][0]);
+        close(reports[j][0]);
+        close(go[j][1]);
+        if (j != i) {
+          close(link[j][1]);
+          close(reports[j][1]);
+          close(go[j][0]);
+        }
+      }
+      peer_main(i, link[i][1], reports[i][1], go[i][0]);
+    }
+  }
+  for (int i = 0; i < PEERS; i++) {
+    close(link[i][1]);
+    close(reports[i][1]);
+    close(go[i][0]);
+    fcntl(link[i][0], F_SETFL, O_NONBLOCK);
+  }
+  for (int i = 0; i < PEERS; i++) {
+    lines[i].from = link[i][0];
+    lines[i].to = link[(i + 1) % PEERS][0];
+  }
+  rng_seed(&link_rng, seed, 0);
+
+  samples_t flows[FLOW_COUNT] = {{0}};
+  uint32_t attempted[FLOW_COUNT] = {0};
+  uint32_t stats[STAT_COUNT] = {0};
+  bool alive[PEERS] = {true, true};
+  int live = PEERS, done = 0;
+
+  /* Start times of the current run, paired across the peers */
+  uint32_t start_us[PEERS];
+  bool start_ok[PEERS], start_known[PEERS] = {false, false};
+
+  while (live > 0) {
+    uint64_t now = now_ns();
+    struct pollfd fds[2 * PEERS];
+    for (int i = 0; i < PEERS; i++) {
+      bool room = lines[i].head - lines[i].tail < LINE_SIZE;
+      fds[i] = (struct pollfd) {lines[i].from, (short) (room ? POLLIN : 0), 0};
+      fds[PEERS + i] = (struct pollfd) {alive[i] ? reports[i][0] : -1, POLLIN, 0};
+    }
+
+    /* Sleep until the next byte is due */
+    uint64_t wait = 100 * 1000000ULL;
+    for (int i = 0; i < PEERS; i++) {
+      if (lines[i].tail == lines[i].head) continue;
+      uint64_t due = lines[i].due[lines[i].tail % LINE_SIZE];
+      uint64_t until = due > now ? due - now : 0;
+      if (until < wait) wait = until;
+    }
+    struct timespec timeout = {(time_t) (wait / 1000000000ULL), (long) (wait % 1000000000ULL)};
+    if (ppoll(fds, 2 * PEERS, &timeout, NULL) < 0 && errno != EINTR) break;
+
+    now = now_ns();
+    for (int i = 0; i < PEERS; i++) {
+      if (fds[i].revents & POLLIN) line_read(&lines[i], now);
+      line_deliver(&lines[i], now);
+    }
+
+    for (int i = 0; i < PEERS; i++) {
+      if (!(fds[PEERS + i].revents & (POLLIN | POLLHUP))) continue;
+      report_t r;
+      if (read(reports[i][0], &r, sizeof(r)) != sizeof(r)) {
+        alive[i] = false;
+        live--;
+      } else if (r.kind == REPORT_FLOW && r.flow < FLOW_COUNT) {
+        attempted[r.flow]++;
+        if (r.ok) samples_add(&flows[r.flow], r.value);
+      } else if (r.kind == REPORT_PROGRESS) {
+        samples_add(&flows[FLOW_PROGRESS], r.value);
+      } else if (r.kind == REPORT_SENT) {
+        attempted[FLOW_PROGRESS] += r.value;
+      } else if (r.kind == REPORT_START) {
+        start_us[i] = r.value;
+        start_ok[i] = r.ok;
+        start_known[i] = true;
+        if (start_known[0] && start_known[1]) {
+          attempted[FLOW_START]++;
+          if (start_ok[0] && start_ok[1]) {
+            int32_t skew = (int32_t) (start_us[0] - start_us[1]);
+            samples_add(&flows[FLOW_START], (uint32_t) (skew < 0 ? -skew : skew));
+          }
+          start_known[0] = start_known[1] = false;
+        }
+      } else if (r.kind == REPORT_STATS && r.flow < STAT_COUNT) {
+        stats[r.flow] += r.value;
+      } else if (r.kind == REPORT_DONE) {
+        done++;
+      }
+
+      /* Every peer finished the run: start the next one together */
+      if (live > 0 && done >= live) {
+        done = 0;
+        for (int j = 0; j < PEERS; j++) {
+          if (alive[j] && write(go[j][1], "g", 1) != 1) perror("link_sim");
+        }
+      }
+    }
+  }
+  for (int i = 0; i < PEERS; i++) waitpid(pids[i], NULL, 0);
+
+  printf("link: %u baud, latency %.1f ms, jitter %.1f ms, corrupt %.4f, drop %.4f, %d runs, seed %llu\n",
+         baud, latency_ns / 1e6, jitter_ns / 1e6, corrupt_rate, drop_rate, runs, (unsigned long long) seed);
+  for (int i = 0; i < PEERS; i++) {
+    printf("%c->%c: %u bytes, %u dropped, %u corrupted\n", 'A' + i, 'A' + (i + 1) % PEERS,
+           lines[i].bytes, lines[i].dropped, lines[i].corrupted);
+  }
+  printf("\n%-10s %13s %7s %9s %9s %9s %9s\n", "flow", "completed", "", "p50 ms", "p90 ms", "p99 ms", "max ms");
+  for (int f = 0; f < FLOW_COUNT; f++) print_flow(flow_names[f], attempted[f], &flows[f]);
+  printf("(connect/ready/finish/confirm: completion time per peer, start: skew between the peers' starts,\n"
+         " progress: one-way latency per frame)\n\n");
+  for (int i = 0; i < STAT_COUNT; i++) printf("%s%s %u", i > 0 ? ", " : "", stat_names[i], stats[i]);
+  printf("\n");
+
+  for (int f = 0; f < FLOW_COUNT; f++) free(flows[f].values);
+  return 0;
+}
@@ -0,0 +1,40 @@
+/*
+ * Interactive check of the serial rings on the host pty stand-in: lines typed
+ * on stdin are sent, received bytes are printed. Connect a second instance
+ * with SERIAL_PTY=<printed path>, or a terminal program on that path.
+ *
+ * Usage: serial_link
+ */
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "serial.h"
+#include "serial_pty.h"
+
+int main() {
+  if (serial_init() != 0) return 1;
+  setvbuf(stdout, NULL, _IONBF, 0);
+
+  struct pollfd fds[2] = {{STDIN_FILENO, POLLIN, 0}, {serial_pty_fd(), POLLIN, 0}};
+  char line[256];
+  bool done = false;
+
+  while (!done && poll(fds, 2, -1) >= 0) {
+    if (fds[1].revents & (POLLIN | POLLHUP)) {
+      serial_ih();
+      char buffer[SERIAL_RX_SIZE];
+      size_t n = serial_read(buffer, sizeof(buffer));
+      if (n > 0) fwrite(buffer, 1, n, stdout);
+      else if (fds[1].revents & POLLHUP) done = true; /* Peer closed its end */
+    }
+    if (fds[0].revents & (POLLIN | POLLHUP)) {
+      ssize_t n = read(STDIN_FILENO, line, sizeof(line));
+      if (n <= 0) done = true;
+      else if (serial_send(line, (size_t) n) != 0) done = true;
+    }
+  }
+
+  serial_cleanup();
+  return 0;
+}
@@ -0,0 +1,127 @@
+#define _XOPEN_SOURCE 600 /* posix_openpt, grantpt, unlockpt, ptsname */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "serial_port.h"
+#include "serial_pty.h"
+
+static int pty_fd = -1;
+static int slave_fd = -1; /* Held open so the master does not hang up while no peer is attached */
+static int attached_fd = -1;
+static char pty_path[128];
+
+/* Raw bytes, no echo or line editing, like the UART */
+static int make_raw(int fd) {
+  struct termios t;
+  if (tcgetattr(fd, &t) != 0) return 1;
+  cfmakeraw(&t);
+  return tcsetattr(fd, TCSANOW, &t);
+}
+
+int serial_pty_fd() {
+  return pty_fd;
+}
+
+const char *serial_pty_path() {
+  return pty_path;
+}
+
+void serial_pty_attach(int fd) {
+  attached_fd = fd;
+}
+
+/* The host has no IRQ line: callers poll serial_pty_fd() and run serial_ih() */
+int serial_subscribe_int(uint8_t *bit_no) {
+  *bit_no = 0;
+  return 1;
+}
+
+int serial_unsubscribe_int() {
+  return 0;
+}
+
+int serial_port_open() {
+  const char *peer = getenv("SERIAL_PTY");
+
+  if (attached_fd >= 0) {
+    /* Not a terminal: only made non-blocking */
+    pty_fd = attached_fd;
+    attached_fd = -1;
+    snprintf(pty_path, sizeof(pty_path), "fd %d", pty_fd);
+    if (fcntl(pty_fd, F_SETFL, fcntl(pty_fd, F_GETFL) | O_NONBLOCK) != 0) {
+      printf("serial_port_open(): %s\n", strerror(errno));
+      close(pty_fd);
+      pty_fd = -1;
+      return 1;
+    }
+    printf("Serial port stand-in on %s\n", pty_path);
+    return 0;
+  } else if (peer != NULL) {
+    pty_fd = open(peer, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    snprintf(pty_path, sizeof(pty_path), "%s", peer);
+  } else {
+    pty_fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (pty_fd >= 0 && (grantpt(pty_fd) != 0 || unlockpt(pty_fd) != 0)) {
+      close(pty_fd);
+      pty_fd = -1;
+    }
+    if (pty_fd >= 0) {
+      snprintf(pty_path, sizeof(pty_path), "%s", ptsname(pty_fd));
+      slave_fd = open(pty_path, O_RDWR | O_NOCTTY);
+      if (slave_fd >= 0) make_raw(slave_fd);
+    }
+  }
+
+  if (pty_fd < 0 || make_raw(pty_fd) != 0) {
+    printf("serial_port_open(): %s\n", strerror(errno));
+    if (pty_fd >= 0) close(pty_fd);
+    pty_fd = -1;
+    return 1;
+  }
+
+  printf("Serial port stand-in on %s\n", pty_path);
+  return 0;
+}
+
+void serial_port_close() {
+  serial_port_start_tx();
+  if (pty_fd >= 0) close(pty_fd);
+  if (slave_fd >= 0) close(slave_fd);
+  pty_fd = -1;
+  slave_fd = -1;
+}
+
+int serial_port_start_tx() {
+  serial_span_t spans[2];
+  if (pty_fd < 0 || serial_tx_pending(spans) == 0) return 0;
+
+  struct iovec iov[2] = {{spans[0].data, spans[0].len}, {spans[1].data, spans[1].len}};
+  serial_port_stats()->write_calls++;
+  ssize_t n = writev(pty_fd, iov, spans[1].len > 0 ? 2 : 1);
+  if (n < 0) return errno == EAGAIN || errno == EINTR || errno == EIO ? 0 : 1;
+
+  serial_tx_consume((size_t) n);
+  return 0;
+}
+
+void serial_port_poll() {
+  serial_span_t spans[2];
+  if (pty_fd < 0 || serial_rx_space(spans) == 0) return;
+
+  struct iovec iov[2] = {{spans[0].data, spans[0].len}, {spans[1].data, spans[1].len}};
+  serial_port_stats()->read_calls++;
+  ssize_t n = readv(pty_fd, iov, spans[1].len > 0 ? 2 : 1);
+  if (n > 0) serial_rx_commit((size_t) n);
+}
+
+void serial_ih() {
+  serial_port_stats()->interrupts++;
+  serial_port_poll();
+  serial_port_start_tx();
+}
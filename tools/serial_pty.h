@@ -0,0 +1,30 @@
+#ifndef _SERIAL_PTY_H_
+#define _SERIAL_PTY_H_
+
+/*
+ * Host stand-in for the COM1 UART (uart.c): the serial rings run on top of a
+ * pseudo-terminal. Without SERIAL_PTY in the environment a new pty is created
+ * and its slave path printed; with SERIAL_PTY=<path> that path is opened, so a
+ * second process can talk to the first one. A harness can also hand over
+ * one end of a socketpair with serial_pty_attach.
+ */
+
+/**
+ * @brief Use an open descriptor (e.g. a socketpair end) at the next serial_init
+ * @param fd Descriptor, owned by the port from then on
+ */
+void serial_pty_attach(int fd);
+
+/**
+ * @brief Descriptor to wait on (poll) for serial events
+ * @return File descriptor, -1 if the port is closed
+ */
+int serial_pty_fd();
+
+/**
+ * @brief Path the peer opens to talk to this end
+ * @return Slave path of the created pty, the opened path otherwise
+ */
+const char *serial_pty_path();
+
+#endif /* _SERIAL_PTY_H_ */
@@ -0,0 +1,61 @@
+/*
+ * Offline decoder of the binary protocol trace written by the game (trace.c):
+ * one line per record, then event counts and delivery latency percentiles.
+ *
+ * Usage: trace_decode [protocol_trace.bin]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "protocol.h"
+#include "trace.h"
+
+static int compare_u32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+  return x < y ? -1 : x > y;
+}
+
+int main(int argc, char *argv[]) {
+  const char *path = argc > 1 ? argv[1] : TRACE_FILE;
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    perror(path);
+    return 1;
+  }
+
+  trace_header_t header;
+  if (fread(&header, sizeof(header), 1, f) != 1 || header.magic != TRACE_MAGIC ||
+      header.record_size != sizeof(trace_record_t)) {
+    fprintf(stderr, "%s: not a protocol trace\n", path);
+    fclose(f);
+    return 1;
+  }
+
+  uint32_t counts[TRACE_EVENT_COUNT] = {0};
+  uint32_t *latencies = malloc((header.count + 1) * sizeof(uint32_t));
+  uint32_t delivered = 0;
+  trace_record_t r;
+
+  printf("%u records (%u older ones overwritten)\n", header.count, header.dropped);
+  printf("%12s  %-12s %-14s %5s %4s %7s %10s\n", "time (ms)", "event", "type", "seq", "len", "session", "value");
+  for (uint32_t i = 0; i < header.count && fread(&r, sizeof(r), 1, f) == 1; i++) {
+    printf("%12.3f  %-12s %-14s %5u %4u %7u %10u\n", r.time_us / 1000.0, trace_event_name(r.event),
+           proto_type_name(r.type), r.seq, r.length, r.session, r.value);
+    if (r.event < TRACE_EVENT_COUNT) counts[r.event]++;
+    if (r.event == TRACE_DELIVERED) latencies[delivered++] = r.value;
+  }
+  fclose(f);
+
+  printf("\n");
+  for (int e = 0; e < TRACE_EVENT_COUNT; e++) {
+    if (counts[e] > 0) printf("%-12s %u\n", trace_event_name((uint8_t) e), counts[e]);
+  }
+
+  if (delivered > 0) {
+    qsort(latencies, delivered, sizeof(uint32_t), compare_u32);
+    printf("delivery latency (us): p50 %u, p90 %u, p99 %u, max %u\n", latencies[delivered / 2],
+           latencies[delivered * 9 / 10], latencies[delivered * 99 / 100], latencies[delivered - 1]);
+  }
+
+  free(latencies);
+  return 0;
+}
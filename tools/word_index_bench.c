@@ -0,0 +1,132 @@
+/*
+ * Host benchmark of the BK-tree word index (word_index.c) against the linear
+ * scan it replaces, on synthetic vocabularies of 10^2, 10^4 and 10^6 words.
+ *
+ * Usage: word_index_bench [queries]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "word_index.h"
+
+#define KEY_STRIDE 16
+#define MAX_RESULTS 4096
+
+static char *vocabulary;
+static uint32_t rng_state = 2463534242u;
+
+static uint32_t next_random() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+static const char *vocabulary_key(int word) {
+  return vocabulary + (size_t) word * KEY_STRIDE;
+}
+
+/* Portuguese-looking words: 2 to 5 consonant-vowel syllables */
+static void random_word(char *out) {
+  static const char consonants[] = "bcdfglmnprstvz";
+  static const char vowels[] = "aeiou";
+  int syllables = 2 + (int) (next_random() % 4), n = 0;
+  for (int s = 0; s < syllables; s++) {
+    out[n++] = consonants[next_random() % (sizeof(consonants) - 1)];
+    out[n++] = vowels[next_random() % (sizeof(vowels) - 1)];
+    if (next_random() % 4 == 0) out[n++] = "rsnl"[next_random() % 4];
+  }
+  out[n] = '\0';
+}
+
+/* A typo of an existing word (one substitution, insertion or deletion) */
+static void mistype(const char *word, char *out) {
+  int length = (int) strlen(word), at = (int) (next_random() % length);
+  char c = (char) ('a' + next_random() % 26);
+  strcpy(out, word);
+  switch (next_random() % 3) {
+    case 0: out[at] = c; break;
+    case 1: memmove(out + at + 1, out + at, length - at + 1); out[at] = c; break;
+    default: memmove(out + at, out + at + 1, length - at); break;
+  }
+}
+
+static double now_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/* What procurarPalavra did: every word, skipping only on length */
+static int linear_search(int count, const char *key, int k) {
+  int length = (int) strlen(key), found = 0;
+  for (int w = 0; w < count; w++) {
+    const char *candidate = vocabulary_key(w);
+    int difference = (int) strlen(candidate) - length;
+    if (difference > k || difference < -k) continue;
+    if (word_index_distance(key, candidate) <= k) found++;
+  }
+  return found;
+}
+
+static int bench(int count, int queries) {
+  vocabulary = malloc((size_t) count * KEY_STRIDE);
+  char (*query)[KEY_STRIDE + 2] = malloc((size_t) queries * sizeof(*query));
+  wi_result_t *results = malloc(MAX_RESULTS * sizeof(wi_result_t));
+  if (vocabulary == NULL || query == NULL || results == NULL) return 1;
+
+  for (int w = 0; w < count; w++) random_word(vocabulary + (size_t) w * KEY_STRIDE);
+  /* Three typos for every word that is not in the vocabulary */
+  for (int q = 0; q < queries; q++) {
+    if (q % 4 == 3) random_word(query[q]);
+    else mistype(vocabulary_key((int) (next_random() % count)), query[q]);
+  }
+
+  word_index_t index;
+  double start = now_us();
+  if (word_index_build(&index, count, vocabulary_key) != 0) return 1;
+  double build_ms = (now_us() - start) / 1e3;
+
+  for (int k = 1; k <= 2; k++) {
+    long visited = 0, matches = 0, mismatches = 0;
+    start = now_us();
+    for (int q = 0; q < queries; q++) {
+      matches += word_index_search(&index, query[q], k, results, MAX_RESULTS);
+      visited += index.visited;
+    }
+    double index_us = (now_us() - start) / queries;
+
+    start = now_us();
+    for (int q = 0; q < queries; q++) {
+      int expected = linear_search(count, query[q], k);
+      if (expected != word_index_search(&index, query[q], k, results, MAX_RESULTS)) mismatches++;
+    }
+    double scan_us = (now_us() - start) / queries - index_us;
+
+    printf("%8d words k=%d | build %8.1f ms | index %9.2f us/query, %5.2f%% visited | "
+           "scan %10.2f us/query | %.1f matches/query | %ld mismatches\n",
+           count, k, build_ms, index_us, 100.0 * visited / ((double) queries * count),
+           scan_us, (double) matches / queries, mismatches);
+  }
+
+  word_index_free(&index);
+  free(vocabulary);
+  free(query);
+  free(results);
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  int queries = argc > 1 ? atoi(argv[1]) : 200;
+  if (queries <= 0) return 1;
+
+  static const int sizes[] = {100, 10000, 1000000};
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    if (bench(sizes[i], queries) != 0) {
+      printf("word_index_bench: out of memory\n");
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Host checks of how typed words resolve against a category of the built-in
+ * dictionary, through both the per-keystroke matcher and the linear scan, in
+ * particular that a word already answered is rejected instead of scoring a
+ * neighbour one typo away ("junho" again is not "julho").
+ *
+ * Usage: word_match_test
+ */
+#include <stdio.h>
+#include <string.h>
+#include "dictionary.h"
+#include "gameLogic.h"
+#include "word_match.h"
+
+static int failures = 0;
+
+static const dict_category_t *category_of(const char *key) {
+  for (int c = 0; c < dictionary_category_count(); c++) {
+    const dict_category_t *category = dictionary_category(c);
+    for (int w = 0; w < (int) category->word_count; w++) {
+      if (strcmp(dictionary_string(dictionary_word(category, w)->key), key) == 0) return category;
+    }
+  }
+  return NULL;
+}
+
+static int word_of(const dict_category_t *category, const char *key) {
+  for (int w = 0; w < (int) category->word_count; w++) {
+    if (strcmp(dictionary_string(dictionary_word(category, w)->key), key) == 0) return w;
+  }
+  return -1;
+}
+
+static const char *key_of(const dict_category_t *category, int word) {
+  return word >= 0 ? dictionary_string(dictionary_word(category, word)->key) : "(none)";
+}
+
+static void check(const char *what, const dict_category_t *category, int got, const char *expected) {
+  int want = expected != NULL ? word_of(category, expected) : -1;
+  bool ok = got == want;
+  printf("%-4s %-40s %s\n", ok ? "ok" : "FAIL", what, key_of(category, got));
+  if (!ok) failures++;
+}
+
+/* Type input into the matcher and resolve it, words listed in answered excluded */
+static int matcher_resolve(const dict_category_t *category, const char *input, const char *answered[]) {
+  static word_matcher_t matcher;
+  if (word_matcher_init(&matcher, category) != 0) return -2;
+  for (const char *c = input; *c; c++) word_matcher_push(&matcher, *c);
+
+  uint32_t exclude = 0;
+  for (int i = 0; answered[i] != NULL; i++) exclude |= (uint32_t) 1 << word_of(category, answered[i]);
+  return word_matcher_resolve(&matcher, exclude);
+}
+
+/* The same through the linear scan (procurarPalavra) */
+static int scan_resolve(const dict_category_t *category, const char *input, const char *answered[]) {
+  conjunto_palavras_t exclude = {0};
+  for (int i = 0; answered[i] != NULL; i++) conjuntoAdicionar(&exclude, word_of(category, answered[i]));
+  return procurarPalavra(category, input, &exclude);
+}
+
+int main() {
+  if (dictionary_use_image(dictionary_data, dictionary_data_size) != 0) return 1;
+  const dict_category_t *months = category_of("junho");
+  const dict_category_t *verbs = category_of("ser");
+  if (months == NULL || verbs == NULL || category_of("julho") != months) {
+    printf("built-in dictionary lacks the test words\n");
+    return 1;
+  }
+
+  const char *none[] = {NULL};
+  const char *junho[] = {"junho", NULL};
+  const char *ser[] = {"ser", NULL};
+
+  check("matcher: junho", months, matcher_resolve(months, "junho", none), "junho");
+  check("matcher: junho again", months, matcher_resolve(months, "junho", junho), NULL);
+  check("matcher: junhp (typo) after junho", months, matcher_resolve(months, "junhp", junho), NULL);
+  check("matcher: ser again", verbs, matcher_resolve(verbs, "ser", ser), NULL);
+  check("matcher: xer, ser answered (tie)", verbs, matcher_resolve(verbs, "xer", ser), "ter");
+
+  check("scan: junho", months, scan_resolve(months, "junho", none), "junho");
+  check("scan: junho again", months, scan_resolve(months, "junho", junho), NULL);
+  check("scan: junhp (typo) after junho", months, scan_resolve(months, "junhp", junho), NULL);
+  check("scan: ser again", verbs, scan_resolve(verbs, "ser", ser), NULL);
+  check("scan: xer, ser answered (tie)", verbs, scan_resolve(verbs, "xer", ser), "ter");
+
+  printf("%s\n", failures == 0 ? "all passed" : "FAILED");
+  return failures != 0;
+}
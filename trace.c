@@ -0,0 +1,69 @@
+#include "trace.h"
+#include <stdio.h>
+
+bool trace_on = false;
+
+static trace_record_t ring[TRACE_RING_SIZE];
+static uint32_t written = 0; /* Records ever written, the ring holds the last TRACE_RING_SIZE */
+static uint64_t (*clock_fn)(void) = NULL;
+static uint64_t start_ns = 0;
+
+static const char *event_names[TRACE_EVENT_COUNT] = {
+  [TRACE_TX] = "TX",
+  [TRACE_RX] = "RX",
+  [TRACE_RX_SKIPPED] = "RX_SKIPPED",
+  [TRACE_RX_CRC] = "RX_CRC",
+  [TRACE_RX_BAD] = "RX_BAD",
+  [TRACE_PEER] = "PEER",
+  [TRACE_RETRANSMIT] = "RETRANSMIT",
+  [TRACE_DUPLICATE] = "DUPLICATE",
+  [TRACE_OUT_OF_ORDER] = "OUT_OF_ORDER",
+  [TRACE_DELIVERED] = "DELIVERED",
+  [TRACE_LOOPBACK] = "LOOPBACK",
+};
+
+void trace_start(uint64_t (*clock_ns)(void)) {
+  clock_fn = clock_ns;
+  start_ns = clock_ns();
+  written = 0;
+  trace_on = true;
+}
+
+void trace_stop() {
+  trace_on = false;
+}
+
+void trace_record(uint8_t event, uint8_t type, uint8_t seq, uint8_t length, uint16_t session, uint32_t value) {
+  trace_record_t *r = &ring[written++ & (TRACE_RING_SIZE - 1)];
+  r->time_us = (uint32_t) ((clock_fn() - start_ns) / 1000);
+  r->event = event;
+  r->type = type;
+  r->seq = seq;
+  r->length = length;
+  r->session = session;
+  r->reserved = 0;
+  r->value = value;
+}
+
+int trace_save(const char *path) {
+  FILE *f = fopen(path, "wb");
+  if (f == NULL) return 1;
+
+  uint32_t count = written < TRACE_RING_SIZE ? written : TRACE_RING_SIZE;
+  trace_header_t header = {TRACE_MAGIC, count, written - count, sizeof(trace_record_t)};
+  bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+
+  /* Oldest first: from the oldest record to the end of the ring, then the wrapped part */
+  uint32_t start = (written - count) & (TRACE_RING_SIZE - 1);
+  uint32_t first = TRACE_RING_SIZE - start < count ? TRACE_RING_SIZE - start : count;
+  if (ok && first > 0) ok = fwrite(&ring[start], sizeof(trace_record_t), first, f) == first;
+  if (ok && count > first) ok = fwrite(ring, sizeof(trace_record_t), count - first, f) == count - first;
+
+  if (fclose(f) != 0) ok = false;
+  if (ok) printf("trace_save(): %u records written to %s\n", count, path);
+  return ok ? 0 : 1;
+}
+
+const char *trace_event_name(uint8_t event) {
+  return event < TRACE_EVENT_COUNT ? event_names[event] : "?";
+}
@@ -0,0 +1,100 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Binary protocol trace: fixed-size records in a ring, written to a file at
+ * exit and decoded offline (tools/trace_decode). While tracing is off each
+ * trace point costs one branch.
+ */
+
+#define TRACE_RING_SIZE 4096        /* Records kept, power of two (oldest are overwritten) */
+#define TRACE_MAGIC 0x31435254      /* "TRC1" */
+#define TRACE_FILE "protocol_trace.bin"
+
+/**
+ * @brief Traced events
+ */
+typedef enum {
+  TRACE_TX,          /* Frame sent */
+  TRACE_RX,          /* Valid frame received */
+  TRACE_RX_SKIPPED,  /* value = bytes skipped looking for a frame */
+  TRACE_RX_CRC,      /* CRC mismatch */
+  TRACE_RX_BAD,      /* Unknown type or wrong length */
+  TRACE_PEER,        /* New peer session */
+  TRACE_RETRANSMIT,  /* Reliable message sent again */
+  TRACE_DUPLICATE,   /* Reliable message received again */
+  TRACE_OUT_OF_ORDER,/* Reliable message received after a gap */
+  TRACE_DELIVERED,   /* Reliable message acknowledged, value = latency in us */
+  TRACE_LOOPBACK,    /* Own frame received back */
+  TRACE_EVENT_COUNT
+} trace_event_t;
+
+/**
+ * @brief Trace record (16 bytes, little-endian in the file)
+ */
+typedef struct {
+  uint32_t time_us;  /* Since tracing started */
+  uint8_t event;     /* trace_event_t */
+  uint8_t type;      /* Message type */
+  uint8_t seq;
+  uint8_t length;    /* Payload length */
+  uint16_t session;  /* Session in the frame */
+  uint16_t reserved;
+  uint32_t value;    /* Event specific */
+} trace_record_t;
+
+/**
+ * @brief Trace file header, followed by count records, oldest first
+ */
+typedef struct {
+  uint32_t magic;    /* TRACE_MAGIC */
+  uint32_t count;    /* Records in the file */
+  uint32_t dropped;  /* Older records overwritten in the ring */
+  uint32_t record_size;
+} trace_header_t;
+
+extern bool trace_on;
+
+/* Record an event, only a branch while tracing is off */
+#define TRACE(event, type, seq, length, session, value) \
+  do { \
+    if (trace_on) trace_record((event), (type), (seq), (length), (session), (value)); \
+  } while (0)
+
+/**
+ * @brief Start tracing, with an empty ring
+ *
+ * @param clock_ns Monotonic clock in nanoseconds
+ */
+void trace_start(uint64_t (*clock_ns)(void));
+
+/**
+ * @brief Stop tracing (the ring is kept until the next trace_start)
+ */
+void trace_stop();
+
+/**
+ * @brief Append a record to the ring (use TRACE instead)
+ */
+void trace_record(uint8_t event, uint8_t type, uint8_t seq, uint8_t length, uint16_t session, uint32_t value);
+
+/**
+ * @brief Write the ring to a file
+ *
+ * @param path File to create
+ * @return 0 on success, 1 on error
+ */
+int trace_save(const char *path);
+
+/**
+ * @brief Name of an event, for the decoder
+ *
+ * @param event Event
+ * @return Name ("?" for unknown events)
+ */
+const char *trace_event_name(uint8_t event);
+
+#endif /* _TRACE_H_ */
@@ -0,0 +1,175 @@
+#include <lcom/lcf.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart.h"
+#include "utils.h"
+#include "serial_port.h"
+
+/* RX trigger level: at 115200 bit/s a byte takes ~87 us, so 8 bytes give one
+ * interrupt per 8 received while leaving 8 free FIFO slots (~0.7 ms) before
+ * an overrun. Shorter messages arrive through the character timeout */
+#define UART_RX_TRIGGER FCR_TRIGGER_8
+#define UART_RX_TRIGGER_BYTES 8
+#define UART_MAX_IIR_LOOPS 16 /* Interrupt sources handled per serial_ih */
+
+static int hook_id = COM1_IRQ;
+static bool subscribed = false;
+
+static int uart_read(uint8_t reg, uint8_t *value) {
+  serial_port_stats()->read_calls++;
+  return util_sys_inb(COM1_BASE + reg, value);
+}
+
+static int uart_write(uint8_t reg, uint8_t value) {
+  serial_port_stats()->write_calls++;
+  return sys_outb(COM1_BASE + reg, value);
+}
+
+int serial_subscribe_int(uint8_t *bit_no) {
+  hook_id = COM1_IRQ;
+  *bit_no = hook_id;
+  
+  if (sys_irqsetpolicy(COM1_IRQ, IRQ_REENABLE | IRQ_EXCLUSIVE, &hook_id) != OK) {
+    printf("serial_subscribe_int(): sys_irqsetpolicy() failed\n");
+    return 1;
+  }
+  
+  subscribed = true;
+  printf("serial_subscribe_int(): Successfully subscribed with hook_id=%d\n", hook_id);
+  return 0;
+}
+
+int serial_unsubscribe_int() {
+  if (!subscribed) return 0;
+  
+  if (sys_irqrmpolicy(&hook_id) != OK) {
+    printf("serial_unsubscribe_int(): sys_irqrmpolicy() failed\n");
+    return 1;
+  }
+  
+  subscribed = false;
+  printf("serial_unsubscribe_int(): Successfully unsubscribed\n");
+  return 0;
+}
+
+/* Read everything in the RX FIFO into the RX ring */
+static void uart_drain_rx() {
+  serial_stats_t *stats = serial_port_stats();
+  serial_span_t spans[2];
+  size_t space = serial_rx_space(spans);
+  size_t received = 0;
+  uint8_t lsr, byte;
+  
+  while (uart_read(UART_LSR, &lsr) == 0 && (lsr & LSR_DR)) {
+    if (lsr & LSR_ERRORS) stats->line_errors++;
+    if (uart_read(UART_RBR, &byte) != 0) break;
+    
+    if (received == space) {
+      stats->rx_overflows++; /* The FIFO must still be emptied */
+      continue;
+    }
+    if (received < spans[0].len) spans[0].data[received] = byte;
+    else spans[1].data[received - spans[0].len] = byte;
+    received++;
+  }
+  
+  serial_rx_commit(received);
+}
+
+/* Refill the TX FIFO from the TX ring when it is empty */
+static void uart_fill_tx() {
+  serial_span_t spans[2];
+  size_t pending = serial_tx_pending(spans);
+  uint8_t lsr;
+  
+  if (pending == 0 || uart_read(UART_LSR, &lsr) != 0 || !(lsr & LSR_THRE)) return;
+  
+  size_t count = pending < UART_FIFO_SIZE ? pending : UART_FIFO_SIZE;
+  size_t sent = 0;
+  for (; sent < count; sent++) {
+    uint8_t byte = sent < spans[0].len ? spans[0].data[sent] : spans[1].data[sent - spans[0].len];
+    if (uart_write(UART_THR, byte) != 0) break;
+  }
+  
+  serial_tx_consume(sent);
+}
+
+int serial_port_open() {
+  uint16_t divisor = UART_CLOCK_DIV / UART_BIT_RATE;
+  uint8_t dummy;
+  
+  /* 8N1 at UART_BIT_RATE */
+  if (uart_write(UART_IER, 0) != 0 ||
+      uart_write(UART_LCR, LCR_DLAB | LCR_8_BITS | LCR_1_STOP | LCR_NO_PARITY) != 0 ||
+      uart_write(UART_DLL, divisor & 0xFF) != 0 ||
+      uart_write(UART_DLM, divisor >> 8) != 0 ||
+      uart_write(UART_LCR, LCR_8_BITS | LCR_1_STOP | LCR_NO_PARITY) != 0) {
+    printf("serial_port_open(): failed to set the line parameters\n");
+    return 1;
+  }
+  
+  if (uart_write(UART_FCR, FCR_ENABLE | FCR_CLEAR_RX | FCR_CLEAR_TX | UART_RX_TRIGGER) != 0 ||
+      uart_write(UART_MCR, MCR_DTR | MCR_RTS | MCR_OUT2) != 0) {
+    printf("serial_port_open(): failed to set up the FIFOs\n");
+    return 1;
+  }
+  
+  /* Clear conditions left pending from before */
+  uart_read(UART_LSR, &dummy);
+  uart_read(UART_RBR, &dummy);
+  uart_read(UART_IIR, &dummy);
+  uart_read(UART_MSR, &dummy);
+  
+  if (uart_write(UART_IER, IER_RDA | IER_THRE | IER_RLS) != 0) {
+    printf("serial_port_open(): failed to enable interrupts\n");
+    return 1;
+  }
+  
+  if (!subscribed) printf("serial_port_open(): COM1 interrupts not subscribed, only polling will work\n");
+  printf("Serial port COM1 configured: %d bit/s 8N1, %d byte FIFO, RX trigger %d\n", UART_BIT_RATE,
+         UART_FIFO_SIZE, UART_RX_TRIGGER_BYTES);
+  return 0;
+}
+
+void serial_port_close() {
+  uart_fill_tx(); /* Last bytes still queued, as far as the FIFO takes them */
+  uart_write(UART_IER, 0);
+}
+
+int serial_port_start_tx() {
+  uart_fill_tx();
+  return 0;
+}
+
+void serial_port_poll() {
+  uart_drain_rx();
+  uart_fill_tx();
+}
+
+void serial_ih() {
+  uint8_t iir, dummy;
+  
+  serial_port_stats()->interrupts++;
+  
+  for (int i = 0; i < UART_MAX_IIR_LOOPS; i++) {
+    if (uart_read(UART_IIR, &iir) != 0 || (iir & IIR_NO_INT)) return;
+    
+    switch (iir & IIR_ID) {
+      case IIR_RLS:
+        uart_read(UART_LSR, &dummy);
+        serial_port_stats()->line_errors++;
+        break;
+      case IIR_RDA:
+      case IIR_CHAR_TO:
+        uart_drain_rx();
+        break;
+      case IIR_THRE:
+        uart_fill_tx();
+        break;
+      case IIR_MODEM:
+      default:
+        uart_read(UART_MSR, &dummy);
+        break;
+    }
+  }
+}
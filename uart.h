@@ -0,0 +1,84 @@
+#ifndef _LCOM_UART_H_
+#define _LCOM_UART_H_
+
+#include <lcom/lcf.h>
+
+/** @defgroup uart uart
+ * @{
+ *
+ * Constants for programming the 16550 UART (serial port COM1).
+ */
+
+#define COM1_BASE 0x3F8 /**< @brief COM1 base I/O address */
+#define COM1_IRQ  4     /**< @brief COM1 IRQ line */
+
+#define UART_CLOCK_DIV 115200 /**< @brief Bit rate for a divisor of 1 */
+#define UART_BIT_RATE  115200 /**< @brief Bit rate used for the link */
+#define UART_FIFO_SIZE 16     /**< @brief Bytes in each 16550 FIFO */
+
+/* Registers (offsets from COM1_BASE) */
+
+#define UART_RBR 0 /**< @brief Receiver Buffer (read, DLAB = 0) */
+#define UART_THR 0 /**< @brief Transmitter Holding (write, DLAB = 0) */
+#define UART_IER 1 /**< @brief Interrupt Enable (DLAB = 0) */
+#define UART_DLL 0 /**< @brief Divisor Latch LSB (DLAB = 1) */
+#define UART_DLM 1 /**< @brief Divisor Latch MSB (DLAB = 1) */
+#define UART_IIR 2 /**< @brief Interrupt Identification (read) */
+#define UART_FCR 2 /**< @brief FIFO Control (write) */
+#define UART_LCR 3 /**< @brief Line Control */
+#define UART_MCR 4 /**< @brief Modem Control */
+#define UART_LSR 5 /**< @brief Line Status */
+#define UART_MSR 6 /**< @brief Modem Status */
+
+/* Interrupt Enable Register bits */
+
+#define IER_RDA  BIT(0) /**< @brief Received data available (and character timeout) */
+#define IER_THRE BIT(1) /**< @brief Transmitter holding register empty */
+#define IER_RLS  BIT(2) /**< @brief Receiver line status */
+
+/* Interrupt Identification Register */
+
+#define IIR_NO_INT   BIT(0) /**< @brief No interrupt pending */
+#define IIR_ID       0x0E   /**< @brief Interrupt source mask */
+#define IIR_MODEM    0x00   /**< @brief Modem status */
+#define IIR_THRE     0x02   /**< @brief Transmitter holding register empty */
+#define IIR_RDA      0x04   /**< @brief Received data reached the trigger level */
+#define IIR_RLS      0x06   /**< @brief Receiver line status (error) */
+#define IIR_CHAR_TO  0x0C   /**< @brief Character timeout: data below the trigger level */
+
+/* FIFO Control Register bits */
+
+#define FCR_ENABLE     BIT(0)            /**< @brief Enable both FIFOs */
+#define FCR_CLEAR_RX   BIT(1)            /**< @brief Clear the receive FIFO */
+#define FCR_CLEAR_TX   BIT(2)            /**< @brief Clear the transmit FIFO */
+#define FCR_TRIGGER_1  0x00              /**< @brief RX interrupt at 1 byte */
+#define FCR_TRIGGER_4  BIT(6)            /**< @brief RX interrupt at 4 bytes */
+#define FCR_TRIGGER_8  BIT(7)            /**< @brief RX interrupt at 8 bytes */
+#define FCR_TRIGGER_14 (BIT(7) | BIT(6)) /**< @brief RX interrupt at 14 bytes */
+
+/* Line Control Register bits */
+
+#define LCR_8_BITS    (BIT(1) | BIT(0)) /**< @brief 8 bits per char */
+#define LCR_1_STOP    0                 /**< @brief 1 stop bit */
+#define LCR_NO_PARITY 0                 /**< @brief No parity */
+#define LCR_DLAB      BIT(7)            /**< @brief Divisor latch access */
+
+/* Modem Control Register bits */
+
+#define MCR_DTR  BIT(0) /**< @brief Data terminal ready */
+#define MCR_RTS  BIT(1) /**< @brief Request to send */
+#define MCR_OUT2 BIT(3) /**< @brief Connects the UART interrupt to the PIC */
+
+/* Line Status Register bits */
+
+#define LSR_DR   BIT(0) /**< @brief Receiver data ready */
+#define LSR_OE   BIT(1) /**< @brief Overrun error */
+#define LSR_PE   BIT(2) /**< @brief Parity error */
+#define LSR_FE   BIT(3) /**< @brief Framing error */
+#define LSR_BI   BIT(4) /**< @brief Break interrupt */
+#define LSR_THRE BIT(5) /**< @brief Transmitter holding register (FIFO) empty */
+#define LSR_ERRORS (LSR_OE | LSR_PE | LSR_FE | LSR_BI)
+
+/**@}*/
+
+#endif /* _LCOM_UART_H_ */
@@ -6,11 +6,13 @@
 #include "singleplayer.h"
 #include "keyboard.h"
 #include "serial.h"
+#include "protocol.h"
+#include "multiplayer.h"
+#include "hrclock.h"
 #include <machine/int86.h>
 #include <lcom/vbe.h>
 #include <string.h>
 #include <stdbool.h>
-#include <time.h>
 
 void *video_mem;         /* Process (virtual) address to which VRAM is mapped */
 static vbe_mode_info_t vmi_p;   /* VBE mode information */
@@ -21,26 +23,25 @@ static uint8_t bytes_per_pixel; /* Bytes per pixel */
 static uint8_t red_mask_size, green_mask_size, blue_mask_size;
 static uint8_t red_field_position, green_field_position, blue_field_position;
 
-/* Game state management */
-static game_state_t current_state = STATE_MAIN_MENU;
+/* Game mode */
 static bool is_multiplayer_mode = false;
 
 /* Singleplayer game instance */
 static bool sp_initialized = false;
 singleplayer_game_t sp_game;
 
-/* Multiplayer connection state */
-static bool mp_test_initialized = false;
-static int mp_test_counter = 0;
-static bool mp_received_ping = false;
-static int mp_connection_timer = 0;
-static uint32_t mp_session_id = 0; /* Unique identifier for each multiplayer session */
-static uint32_t mp_last_sent_time = 0; /* Track when we last sent a message to ignore loopback */
-static char mp_vm_id = 'A'; /* This VM's identifier (A or B) */
+/* Multiplayer timing */
+#define MP_DOT_PERIOD_NS (250 * NS_PER_MS)     /* One more animation dot every quarter second */
+
+/* Multiplayer screens (the session itself is in multiplayer.c) */
+static bool mp_serial_failed = false; /* serial_init failed when entering 2 player mode */
+static uint64_t mp_anim_start_ns = 0; /* Drives the "Searching..."/"Please wait..." animation */
+static int mp_dots = 1;               /* Dots currently shown by the animation (1-4) */
+
+/* Waiting-for-other-player state */
+static bool sent_our_finished = false;       /* Our GAME_FINISHED was acknowledged */
 
 /* Multiplayer results data */
-static char mp_other_player_initials[4] = {0}; /* Other player's initials */
-static int mp_other_player_score = 0; /* Other player's score */
 static bool mp_results_ready = false; /* Both scores received and ready to show results */
 
 int map_vram(uint16_t mode) {
@@ -525,55 +526,17 @@ int draw_main_page_with_hover(uint16_t mouse_x, uint16_t mouse_y) {
   return 0;
 }
 
-game_state_t get_game_state() {
-  return current_state;
-}
-
-void set_game_state(game_state_t state) {
-  current_state = state;
-}
-
-int draw_current_page(uint16_t mouse_x, uint16_t mouse_y) {
-  switch (current_state) {
-    case STATE_MAIN_MENU:
-      return draw_main_page_with_hover(mouse_x, mouse_y);
-    case STATE_SINGLE_PLAYER:
-      return draw_init_sp_game();
-    case STATE_MULTIPLAYER:
-      return draw_init_mp_game();
-    case STATE_MULTIPLAYER_TEST:
-      return draw_multiplayer_test_screen();
-    case STATE_MP_WAITING_FOR_OTHER_PLAYER:
-      return draw_mp_waiting_for_other_player();
-    case STATE_MP_RESULTS:
-      return draw_mp_results_screen();
-    case STATE_LEADERBOARD:
-      return draw_leaderboard_with_hover(mouse_x, mouse_y);
-    case STATE_INSTRUCTIONS:
-      return draw_instructions_with_mouse(mouse_x, mouse_y);
-    case STATE_SP_ENTER_INITIALS:
-      return draw_enter_initials_page(mouse_x, mouse_y);
-    case STATE_SP_COUNTDOWN:
-      return draw_countdown_page(); /* No mouse support */
-    case STATE_SP_LETTER_RAIN:
-      return game_draw_letter_rain(get_current_game()); /* No mouse support */
-    case STATE_SP_PLAYING:
-      /* Initialize and use singleplayer game */
-      if (!sp_initialized) {
-        /* Get player info from letter_rain phase */
-        jogo_t *game = get_current_game();
-        singleplayer_init(&sp_game, game->nome, game->letra);
-        sp_initialized = true;
-        printf("Singleplayer game initialized with player=%s, letter=%c\n", 
-               game->nome, game->letra);
-      }
-      
-      /* Update and draw singleplayer game */
-      singleplayer_update(&sp_game);
-      return singleplayer_draw(&sp_game);
-    default:
-      return draw_main_page_with_hover(mouse_x, mouse_y);
+singleplayer_game_t *get_singleplayer_game() {
+  /* Lazily start the word phase with the player info from the letter rain phase */
+  if (!sp_initialized) {
+    jogo_t *game = get_current_game();
+    singleplayer_init(&sp_game, game->nome, game->letra);
+    sp_initialized = true;
+    printf("Singleplayer game initialized with player=%s, letter=%c\n", 
+           game->nome, game->letra);
   }
+  
+  return &sp_game;
 }
 
 int draw_instructions() {
@@ -742,15 +705,31 @@ int draw_init_sp_game() {
   uint16_t title_x = (get_h_res() - strlen(title) * 8 * 3) / 2;
   if (draw_string_scaled(title_x, 50, title, orange, 3) != 0) return 1;
   
-  /* Draw game setup */
+  /* Draw game setup (normally never seen, entering the state moves straight to initials) */
   if (draw_string_scaled(100, 200, "Iniciando modo single player...", white, 2) != 0) return 1;
   
-  /* Initialize game and move to initials entry IMMEDIATELY */
-  jogo_t *game = get_current_game();
-  game_init(game);
-  set_game_state(STATE_SP_ENTER_INITIALS);
+  return 0;
+}
+
+int init_mp_game() {
+  /* Reset multiplayer state for clean start */
+  reset_multiplayer_connection();
+  
+  /* Initialize serial communication */
+  if (serial_init() != 0) {
+    mp_serial_failed = true;
+    return 1;
+  }
+  mp_serial_failed = false;
   
-  /* Don't draw the "preparing" message - go straight to initials */
+  /* Drop any stale messages left from a previous session */
+  size_t stale = serial_discard();
+  if (stale > 0) {
+    printf("Cleared %u stale bytes during reset\n", (unsigned) stale);
+  }
+  
+  /* Transition to test state */
+  set_game_state(STATE_MULTIPLAYER_TEST);
   return 0;
 }
 
@@ -760,9 +739,6 @@ int draw_init_mp_game() {
   uint32_t orange = 0xff6b35;
   uint32_t white = 0xffffff;
   
-  /* Reset multiplayer state for clean start */
-  reset_multiplayer_connection();
-  
   /* Clear screen */
   if (clear_screen(bg_color) != 0) return 1;
   
@@ -771,13 +747,10 @@ int draw_init_mp_game() {
   uint16_t title_x = (h_res - strlen(title) * 8 * 3) / 2;
   if (draw_string_scaled(title_x, 50, title, orange, 3) != 0) return 1;
   
-  /* Initialize serial communication */
-  if (serial_init() == 0) {
+  /* Serial status (init_mp_game already moved on to the test state on success) */
+  if (!mp_serial_failed) {
     if (draw_string_scaled(100, 200, "Serial port initialized successfully!", white, 2) != 0) return 1;
     if (draw_string_scaled(100, 250, "Starting connection test...", white, 2) != 0) return 1;
-    
-    /* Transition to test state */
-    set_game_state(STATE_MULTIPLAYER_TEST);
   } else {
     if (draw_string_scaled(100, 200, "ERROR: Failed to initialize serial port!", 0xff4444, 2) != 0) return 1;
     if (draw_string_scaled(100, 250, "Check your VM serial port configuration", white, 1) != 0) return 1;
@@ -799,47 +772,96 @@ void reset_singleplayer() {
 /* Reset multiplayer connection state */
 void reset_multiplayer_connection() {
   printf("=== RESETTING MULTIPLAYER CONNECTION STATE ===\n");
-  mp_test_initialized = false;
-  mp_test_counter = 0;
-  mp_received_ping = false;
-  mp_connection_timer = 0;
+  sent_our_finished = false;
   is_multiplayer_mode = false;
-  
-  /* Reset multiplayer results data */
-  memset(mp_other_player_initials, 0, sizeof(mp_other_player_initials));
-  mp_other_player_score = 0;
   mp_results_ready = false;
+  mp_reset();
+}
+
+bool is_in_multiplayer_mode() {
+  return is_multiplayer_mode;
+}
+
+/* Redraw for what the other player sent */
+static void mp_redraw_on(uint32_t received) {
+  if (received & (1u << MSG_GAME_FINISHED)) request_page_redraw();
+  if ((received & (1u << MSG_PROGRESS)) && get_game_state() == STATE_SP_PLAYING) request_page_redraw();
+}
+
+int receive_multiplayer_test() {
+  mp_redraw_on(mp_receive_connecting());
+  return 0;
+}
+
+int receive_mp_game() {
+  if (is_multiplayer_mode) mp_redraw_on(mp_receive_connected());
+  return 0;
+}
+
+void send_mp_progress() {
+  if (!is_multiplayer_mode || sp_game.state != SP_STATE_PLAYING) return;
+  mp_send_progress(sp_game.player_initials, sp_game.total_score, sp_game.answered_count,
+                   (int)sp_game.remaining_seconds);
+}
+
+void update_mp_game() {
+  if (!is_multiplayer_mode) return;
   
-  /* Generate unique session ID for this multiplayer session */
-  /* Use a combination of time, process ID-like value, and random to ensure uniqueness */
-  static uint32_t vm_instance_id = 0;
-  if (vm_instance_id == 0) {
-    vm_instance_id = (uint32_t)time(NULL) % 1000; /* Use last 3 digits of time as VM identifier */
+  /* READYs go out again until acknowledged, progress held back by the rate limit goes out now */
+  mp_tick();
+  send_mp_progress();
+}
+
+const mp_progress_t *get_mp_opponent_progress() {
+  return is_multiplayer_mode ? mp_opponent() : NULL;
+}
+
+void start_multiplayer_test() {
+  printf("=== MULTIPLAYER MODE STARTED ===\n");
+  printf("Waiting for connection with other player...\n");
+  
+  /* Drop any stray data from the serial buffer */
+  size_t stray = serial_discard();
+  if (stray > 0) {
+    printf("Cleared %u stray bytes from serial buffer\n", (unsigned) stray);
   }
-  vm_instance_id++; /* Increment for each session */
-  
-  mp_session_id = ((uint32_t)time(NULL) * 1000) + vm_instance_id + (uint32_t)rand() % 1000;
-  
-  /* Determine VM identifier based on last digit of session ID to ensure uniqueness */
-  mp_vm_id = ((mp_session_id % 100) < 50) ? 'A' : 'B';
   
-  printf("Generated unique session ID: %u (VM instance: %u, VM ID: %c)\n", mp_session_id, vm_instance_id, mp_vm_id);
+  /* Announce ourselves, retransmitted until the other player acknowledges it */
+  printf("=== SENDING CONNECT MESSAGE ===\n");
+  mp_send_connect();
   
-  /* Also reset any static variables in waiting state by clearing serial buffer */
-  if (serial_init() == 0) {
-    char dummy;
-    int clear_count = 0;
-    while ((dummy = serial_read_char()) != 0 && clear_count < 100) {
-      clear_count++;
-    }
-    if (clear_count > 0) {
-      printf("Cleared %d stale messages during reset\n", clear_count);
-    }
+  mp_anim_start_ns = hrclock_now_ns();
+  mp_dots = 1;
+}
+
+/* Advance the "Searching..."/"Please wait..." animation, the page only changes when a dot is added */
+static void update_mp_dots() {
+  int dots = (int)((hrclock_elapsed_ns(mp_anim_start_ns) / MP_DOT_PERIOD_NS) % 4) + 1;
+  if (dots != mp_dots) {
+    mp_dots = dots;
+    request_page_redraw();
   }
 }
 
-bool is_in_multiplayer_mode() {
-  return is_multiplayer_mode;
+int update_multiplayer_test() {
+  /* CONNECT retransmits and clock samples, then the handshake once both sides are there */
+  if (mp_update_connecting()) {
+    printf("Connection established! Both players detected\n");
+    
+    /* Set multiplayer mode flag */
+    is_multiplayer_mode = true;
+    
+    /* Initialize game and transition to initials entry (redrawn by the main loop) */
+    jogo_t *game = get_current_game();
+    game_init(game);
+    set_game_state(STATE_SP_ENTER_INITIALS);
+    
+    return 0;
+  }
+  
+  update_mp_dots();
+  
+  return 0;
 }
 
 int draw_multiplayer_test_screen() {
@@ -850,8 +872,6 @@ int draw_multiplayer_test_screen() {
   uint32_t green = 0x00ff00;
   uint32_t yellow = 0xffff00;
   
-  static int total_chars_received = 0;
-  
   /* Clear screen */
   if (clear_screen(bg_color) != 0) return 1;
   
@@ -860,200 +880,6 @@ int draw_multiplayer_test_screen() {
   uint16_t title_x = (h_res - strlen(title) * 8 * 3) / 2;
   if (draw_string_scaled(title_x, 50, title, orange, 3) != 0) return 1;
   
-  /* Initialize test on first run */
-  if (!mp_test_initialized) {
-    printf("=== MULTIPLAYER MODE STARTED ===\n");
-    printf("Waiting for connection with other player...\n");
-    
-    /* Clear any stray data from serial buffer */
-    char dummy;
-    int clear_count = 0;
-    while ((dummy = serial_read_char()) != 0 && clear_count < 100) {
-      clear_count++;
-    }
-    if (clear_count > 0) {
-      printf("Cleared %d stray characters from serial buffer\n", clear_count);
-    }
-    
-    /* Send initial test message */
-    printf("=== SENDING INITIAL TEST MESSAGE ===\n");
-    int test_result = serial_send_string("CONNECT_TEST\n");
-    if (test_result == 0) {
-      printf("Initial CONNECT_TEST message sent successfully\n");
-    } else {
-      printf("ERROR: Failed to send initial CONNECT_TEST message! Error code: %d\n", test_result);
-    }
-    
-    mp_test_counter = 0;
-    mp_received_ping = false;
-    mp_connection_timer = 0;
-    total_chars_received = 0;
-    mp_test_initialized = true;
-  }
-  
-  /* Always send ping messages every 30 timer ticks (about 0.5 seconds) */
-  mp_test_counter++;
-  if (mp_test_counter >= 30) {
-    printf("=== SENDING CONNECT_PING MESSAGE ===\n");
-    int send_result = serial_send_string("CONNECT_PING\n");
-    if (send_result == 0) {
-      printf("CONNECT_PING sent successfully (received_ping=%s)\n", mp_received_ping ? "true" : "false");
-    } else {
-      printf("ERROR: Failed to send CONNECT_PING! Error code: %d\n", send_result);
-    }
-    mp_test_counter = 0;
-  }
-  
-  /* Check for incoming messages */
-  char c;
-  static char msg_buffer[64] = {0};
-  static int msg_pos = 0;
-  
-  while ((c = serial_read_char()) != 0) {
-    total_chars_received++;
-    printf("Received char #%d: '%c' (0x%02X)\n", total_chars_received, 
-           (c >= 32 && c <= 126) ? c : '?', (unsigned char)c);
-    
-    if (c == '\n' || c == '\r') {
-      /* Complete message received */
-      msg_buffer[msg_pos] = '\0';
-      if (strlen(msg_buffer) > 0) {
-        printf("=== COMPLETE MESSAGE RECEIVED ===\n");
-        printf("Message: '%s' (length: %d)\n", msg_buffer, (int)strlen(msg_buffer));
-        
-        if (strstr(msg_buffer, "CONNECT_PING") != NULL) {
-          printf("*** CONNECT_PING DETECTED! Setting received_ping = true ***\n");
-          mp_received_ping = true;
-        } else if (strstr(msg_buffer, "CONNECT_TEST") != NULL) {
-          printf("*** CONNECT_TEST MESSAGE DETECTED! Basic communication working ***\n");
-        } else if (strstr(msg_buffer, "GAME_FINISHED") != NULL) {
-          printf("*** IGNORING GAME_FINISHED message - other player finished but we're still connecting ***\n");
-        } else if (strstr(msg_buffer, "CONFIRMED_FINISHED") != NULL) {
-          printf("*** IGNORING CONFIRMED_FINISHED message - game coordination while connecting ***\n");
-        } else if (strstr(msg_buffer, "GAME_FINISHED_") != NULL && strlen(msg_buffer) > 14) {
-          char sender_vm_id = msg_buffer[14]; /* Extract VM ID from message */
-          printf("*** DEBUG: Message sender VM ID=%c ***\n", sender_vm_id);
-          
-          if (sender_vm_id != mp_vm_id) { /* Accept any message NOT from our own VM */
-            printf("*** VALID GAME_FINISHED FROM OTHER VM %c DETECTED! ***\n", sender_vm_id);
-            printf("*** Other player has finished their game! ***\n");
-            
-            /* Parse the message to extract initials and score */
-            /* Format: GAME_FINISHED_X_SESSION_INITIALS_SCORE */
-            char msg_copy[64];
-            strcpy(msg_copy, msg_buffer);
-            char *token = strtok(msg_copy, "_");
-            int token_count = 0;
-            char temp_initials[4] = {0};
-            int temp_score = 0;
-            
-            printf("*** DEBUG: Parsing message '%s' ***\n", msg_buffer);
-            
-            while (token != NULL && token_count < 6) {
-              printf("*** DEBUG: Token %d = '%s' ***\n", token_count, token);
-              if (token_count == 4) { /* Initials are the 5th token (index 4) */
-                strncpy(temp_initials, token, 3);
-                temp_initials[3] = '\0';
-                printf("*** DEBUG: Extracted initials = '%s' ***\n", temp_initials);
-              } else if (token_count == 5) { /* Score is the 6th token (index 5) */
-                temp_score = atoi(token);
-                printf("*** DEBUG: Extracted score = %d ***\n", temp_score);
-              }
-              token = strtok(NULL, "_");
-              token_count++;
-            }
-            
-            /* Store other player's data only if we got valid initials */
-            if (strlen(temp_initials) > 0) {
-              strcpy(mp_other_player_initials, temp_initials);
-              mp_other_player_score = temp_score;
-              mp_results_ready = true;
-              
-              printf("*** Other player: %s with score %d ***\n", mp_other_player_initials, mp_other_player_score);
-            } else {
-              printf("*** ERROR: Failed to parse other player's initials from message ***\n");
-            }
-            
-            /* Send confirmation with our VM ID */
-            char confirm_msg[64];
-            sprintf(confirm_msg, "CONFIRMED_FINISHED_%c_%u\n", mp_vm_id, mp_session_id);
-            serial_send_string(confirm_msg);
-            printf("*** Sent CONFIRMED_FINISHED from VM %c to VM %c ***\n", mp_vm_id, sender_vm_id);
-          } else if (sender_vm_id == mp_vm_id) {
-            printf("*** LOOPBACK: Ignoring our own GAME_FINISHED message ***\n");
-          } else {
-            printf("*** UNKNOWN VM ID %c in GAME_FINISHED message ***\n", sender_vm_id);
-          }
-        }
-        else if (strstr(msg_buffer, "CONFIRMED_FINISHED_") != NULL && strlen(msg_buffer) > 18) {
-          char sender_vm_id = msg_buffer[18]; /* Extract VM ID from confirmation message */
-          printf("*** DEBUG: Confirmation sender VM ID=%c ***\n", sender_vm_id);
-          
-          if (sender_vm_id == mp_vm_id) {
-            printf("*** VALID CONFIRMED_FINISHED FROM OTHER VM %c DETECTED! ***\n", sender_vm_id);
-            printf("*** Other VM confirmed they received our GAME_FINISHED! ***\n");
-            mp_results_ready = true;
-          } else if (sender_vm_id == mp_vm_id) {
-            printf("*** LOOPBACK: Ignoring our own CONFIRMED_FINISHED message ***\n");
-          } else {
-            printf("*** UNKNOWN VM ID %c in CONFIRMED_FINISHED message ***\n", sender_vm_id);
-          }
-        }
-        else {
-          printf("*** IGNORING UNKNOWN MESSAGE: '%s' ***\n", msg_buffer);
-        }
-      } else {
-        printf("Empty message received (just newline)\n");
-      }
-      
-      /* Reset buffer */
-      msg_pos = 0;
-      memset(msg_buffer, 0, sizeof(msg_buffer));
-    } else if ((size_t)msg_pos < sizeof(msg_buffer) - 1) {
-      msg_buffer[msg_pos++] = c;
-      printf("Added to buffer. Buffer now: '%s' (pos: %d)\n", msg_buffer, msg_pos);
-    } else {
-      printf("Buffer full! Dropping character.\n");
-    }
-  }
-  
-  /* Show status every 60 ticks */
-  static int status_counter = 0;
-  status_counter++;
-  if (status_counter >= 60) {
-    printf("=== STATUS UPDATE ===\n");
-    printf("Total characters received so far: %d\n", total_chars_received);
-    printf("Received ping flag: %s\n", mp_received_ping ? "true" : "false");
-    printf("Connection timer: %d\n", mp_connection_timer);
-    status_counter = 0;
-  }
-  
-  /* Once we've received a ping, start countdown to connection */
-  if (mp_received_ping) {
-    mp_connection_timer++;
-    printf("Connection timer: %d\n", mp_connection_timer);
-    
-    /* Wait 60 ticks (1 second) after receiving first ping to ensure stability */
-    if (mp_connection_timer >= 60) {
-      printf("Connection established! Both players detected\n");
-      
-      /* Set multiplayer mode flag */
-      is_multiplayer_mode = true;
-      
-      /* Initialize game and transition to initials entry */
-      jogo_t *game = get_current_game();
-      game_init(game);
-      set_game_state(STATE_SP_ENTER_INITIALS);
-      
-      /* Force immediate redraw of new state */
-      uint16_t mouse_x = 400; /* Default mouse position */
-      uint16_t mouse_y = 300;
-      draw_current_page(mouse_x, mouse_y);
-      
-      return 0;
-    }
-  }
-  
   /* Draw waiting screen */
   uint16_t center_x = h_res / 2;
   uint16_t center_y = v_res / 2;
@@ -1071,13 +897,8 @@ int draw_multiplayer_test_screen() {
   if (draw_string_scaled(status_x, center_y - 20, status_msg, yellow, 1) != 0) return 1;
   
   /* Animated dots to show it's working */
-  static int dot_counter = 0;
-  dot_counter++;
-  if (dot_counter >= 60) dot_counter = 0; /* Reset every second */
-  
-  char dots_msg[10] = "Searching";
-  int num_dots = (dot_counter / 15) + 1; /* 1-4 dots */
-  for (int i = 0; i < num_dots && i < 4; i++) {
+  char dots_msg[16] = "Searching";
+  for (int i = 0; i < mp_dots && i < 4; i++) {
     strcat(dots_msg, ".");
   }
   
@@ -1086,7 +907,7 @@ int draw_multiplayer_test_screen() {
   if (draw_string_scaled(dots_x, center_y + 20, dots_msg, green, 1) != 0) return 1;
   
   /* Serial port status */
-  const char *serial_msg = "Serial Port: /dev/tty00 - ACTIVE";
+  const char *serial_msg = "Serial Port: COM1 - ACTIVE";
   uint16_t serial_width = strlen(serial_msg) * 8;
   uint16_t serial_x = center_x - serial_width / 2;
   if (draw_string_scaled(serial_x, center_y + 60, serial_msg, green, 1) != 0) return 1;
@@ -1107,6 +928,55 @@ int draw_multiplayer_test_screen() {
   return 0;
 }
 
+int receive_mp_waiting_for_other_player() {
+  mp_redraw_on(mp_receive_connected());
+  return 0;
+}
+
+void start_mp_waiting_for_other_player() {
+  printf("=== PLAYER FINISHED - WAITING FOR OTHER PLAYER ===\n");
+  sent_our_finished = false;
+  mp_anim_start_ns = hrclock_now_ns();
+  mp_dots = 1;
+  
+  /* Initials and score, retransmitted until acknowledged. Frames already
+   * received are kept: the other player may have finished first */
+  mp_send_finished(sp_game.player_initials, sp_game.total_score);
+  
+  /* Their GAME_FINISHED may be waiting in the RX ring */
+  receive_mp_waiting_for_other_player();
+}
+
+int update_mp_waiting_for_other_player() {
+  /* GAME_FINISHED goes out again until acknowledged */
+  mp_tick();
+  if (!sent_our_finished && mp_all_delivered()) {
+    printf("*** Other player acknowledged our GAME_FINISHED ***\n");
+    sent_our_finished = true;
+    request_page_redraw();
+  }
+  
+  /* Both results delivered, within a round trip of the second player finishing */
+  if (sent_our_finished && mp_opponent_finished()) {
+    printf("=== BOTH PLAYERS CONFIRMED FINISHED - SHOWING MULTIPLAYER RESULTS ===\n");
+    
+    /* Set results ready flag */
+    mp_results_ready = true;
+    
+    /* Reset multiplayer mode flag but keep results data */
+    is_multiplayer_mode = false;
+    
+    /* Transition to multiplayer results screen */
+    set_game_state(STATE_MP_RESULTS);
+    
+    return 0;
+  }
+  
+  update_mp_dots();
+  
+  return 0;
+}
+
 int draw_mp_waiting_for_other_player() {
   /* Define colors */
   uint32_t bg_color = 0x1a1a2e;
@@ -1115,13 +985,6 @@ int draw_mp_waiting_for_other_player() {
   uint32_t green = 0x00ff00;
   uint32_t yellow = 0xffff00;
   
-  static bool waiting_initialized = false;
-  static bool other_player_finished = false;
-  static bool sent_our_finished = false;
-  static bool received_their_finished = false;
-  static int message_counter = 0;
-  static int confirmation_wait_timer = 0;
-  
   /* Clear screen */
   if (clear_screen(bg_color) != 0) return 1;
   
@@ -1130,199 +993,6 @@ int draw_mp_waiting_for_other_player() {
   uint16_t title_x = (h_res - strlen(title) * 8 * 3) / 2;
   if (draw_string_scaled(title_x, 50, title, orange, 3) != 0) return 1;
   
-  /* Initialize waiting state */
-  if (!waiting_initialized) {
-    printf("=== PLAYER FINISHED - WAITING FOR OTHER PLAYER ===\n");
-    other_player_finished = false;
-    sent_our_finished = false;
-    received_their_finished = false;
-    message_counter = 0;
-    confirmation_wait_timer = 0;
-    waiting_initialized = true;
-    
-    /* AGGRESSIVELY clear any stale messages from serial buffer */
-    printf("=== AGGRESSIVELY CLEARING STALE MESSAGES ===\n");
-    char dummy;
-    int clear_count = 0;
-    
-    /* Clear in multiple passes with delays */
-    for (int pass = 0; pass < 5; pass++) {
-      int pass_count = 0;
-      while ((dummy = serial_read_char()) != 0 && clear_count < 500) {
-        clear_count++;
-        pass_count++;
-      }
-      printf("Pass %d: cleared %d messages\n", pass + 1, pass_count);
-      
-      /* Small delay between passes to let any in-transit messages arrive */
-      for (int delay = 0; delay < 10000; delay++) {
-        /* Simple delay loop */
-      }
-    }
-    
-    printf("Total cleared: %d stale messages from serial buffer\n", clear_count);
-    printf("=== BUFFER CLEARING COMPLETE ===\n");
-  }
-  
-  /* Send "FINISHED" message periodically every 60 ticks (1 second) to ensure delivery */
-  message_counter++;
-  if (message_counter >= 60) {
-    printf("=== SENDING GAME_FINISHED MESSAGE ===\n");
-    
-    /* Include session ID, VM ID, score and initials */
-    extern singleplayer_game_t sp_game;
-    char session_msg[128];
-    sprintf(session_msg, "GAME_FINISHED_%c_%u_%s_%d\n", 
-            mp_vm_id, mp_session_id, sp_game.player_initials, sp_game.total_score);
-    printf("Sending exact message from VM %c: '%s'\n", mp_vm_id, session_msg);
-    
-    int send_result = serial_send_string(session_msg);
-    if (send_result == 0) {
-      printf("*** GAME_FINISHED sent successfully from VM %c with session ID %u ***\n", mp_vm_id, mp_session_id);
-      sent_our_finished = true;
-      mp_last_sent_time = (uint32_t)time(NULL); /* Track when we sent this message */
-    } else {
-      printf("ERROR: Failed to send GAME_FINISHED message! Error code: %d\n", send_result);
-    }
-    message_counter = 0;
-  }
-  
-  /* Check for messages from other player */
-  char c;
-  static char msg_buffer[64] = {0};
-  static int msg_pos = 0;
-  
-  while ((c = serial_read_char()) != 0) {
-    if (c == '\n' || c == '\r') {
-      /* Complete message received */
-      msg_buffer[msg_pos] = '\0';
-      if (strlen(msg_buffer) > 0) {
-        printf("=== WAITING STATE MESSAGE ANALYSIS ===\n");
-        printf("Raw message: '%s' (length: %d)\n", msg_buffer, (int)strlen(msg_buffer));
-        
-        /* ONLY process GAME_FINISHED and CONFIRMED_FINISHED messages with current session ID */
-        char expected_game_finished[64];
-        char expected_confirmed[64];
-        char other_vm_id = (mp_vm_id == 'A') ? 'B' : 'A'; /* Get the OTHER VM's ID */
-        sprintf(expected_game_finished, "GAME_FINISHED_%c_%u", other_vm_id, mp_session_id);
-        sprintf(expected_confirmed, "CONFIRMED_FINISHED_%c_%u", other_vm_id, mp_session_id);
-        
-        printf("*** DEBUG: Our VM ID=%c, Other VM ID=%c, Our Session=%u ***\n", mp_vm_id, other_vm_id, mp_session_id);
-        printf("*** DEBUG: Expected GAME_FINISHED='%s' ***\n", expected_game_finished);
-        printf("*** DEBUG: Expected CONFIRMED='%s' ***\n", expected_confirmed);
-        
-        /* Check if this is a GAME_FINISHED message from the other VM (ignore session ID) */
-        if (strstr(msg_buffer, "GAME_FINISHED_") != NULL && strlen(msg_buffer) > 14) {
-          char sender_vm_id = msg_buffer[14]; /* Extract VM ID from message */
-          printf("*** DEBUG: Message sender VM ID=%c ***\n", sender_vm_id);
-          
-          if (sender_vm_id != mp_vm_id) { /* Accept any message NOT from our own VM */
-            printf("*** VALID GAME_FINISHED FROM OTHER VM %c DETECTED! ***\n", sender_vm_id);
-            printf("*** Other player has finished their game! ***\n");
-            
-            /* Parse the message to extract initials and score */
-            /* Format: GAME_FINISHED_X_SESSION_INITIALS_SCORE */
-            char msg_copy[64];
-            strcpy(msg_copy, msg_buffer);
-            char *token = strtok(msg_copy, "_");
-            int token_count = 0;
-            char temp_initials[4] = {0};
-            int temp_score = 0;
-            
-            printf("*** DEBUG: Parsing message '%s' ***\n", msg_buffer);
-            
-            while (token != NULL && token_count < 6) {
-              printf("*** DEBUG: Token %d = '%s' ***\n", token_count, token);
-              if (token_count == 4) { /* Initials are the 5th token (index 4) */
-                strncpy(temp_initials, token, 3);
-                temp_initials[3] = '\0';
-                printf("*** DEBUG: Extracted initials = '%s' ***\n", temp_initials);
-              } else if (token_count == 5) { /* Score is the 6th token (index 5) */
-                temp_score = atoi(token);
-                printf("*** DEBUG: Extracted score = %d ***\n", temp_score);
-              }
-              token = strtok(NULL, "_");
-              token_count++;
-            }
-            
-            /* Store other player's data only if we got valid initials */
-            if (strlen(temp_initials) > 0) {
-              strcpy(mp_other_player_initials, temp_initials);
-              mp_other_player_score = temp_score;
-              received_their_finished = true;
-              
-              printf("*** Other player: %s with score %d ***\n", mp_other_player_initials, mp_other_player_score);
-            } else {
-              printf("*** ERROR: Failed to parse other player's initials from message ***\n");
-            }
-            
-            /* Send confirmation with our VM ID */
-            char confirm_msg[64];
-            sprintf(confirm_msg, "CONFIRMED_FINISHED_%c_%u\n", mp_vm_id, mp_session_id);
-            serial_send_string(confirm_msg);
-            printf("*** Sent CONFIRMED_FINISHED from VM %c to VM %c ***\n", mp_vm_id, sender_vm_id);
-          } else if (sender_vm_id == mp_vm_id) {
-            printf("*** LOOPBACK: Ignoring our own GAME_FINISHED message ***\n");
-          } else {
-            printf("*** UNKNOWN VM ID %c in GAME_FINISHED message ***\n", sender_vm_id);
-          }
-        }
-        /* Check if this is a CONFIRMED_FINISHED message from the other VM */
-        else if (strstr(msg_buffer, "CONFIRMED_FINISHED_") != NULL && strlen(msg_buffer) > 18) {
-          char sender_vm_id = msg_buffer[18]; /* Extract VM ID from confirmation message */
-          printf("*** DEBUG: Confirmation sender VM ID=%c ***\n", sender_vm_id);
-          
-          if (sender_vm_id != mp_vm_id) { /* Accept any message NOT from our own VM */
-            printf("*** VALID CONFIRMED_FINISHED FROM OTHER VM %c DETECTED! ***\n", sender_vm_id);
-            printf("*** Other VM confirmed they received our GAME_FINISHED! ***\n");
-            received_their_finished = true;
-          } else if (sender_vm_id == mp_vm_id) {
-            printf("*** LOOPBACK: Ignoring our own CONFIRMED_FINISHED message ***\n");
-          } else {
-            printf("*** UNKNOWN VM ID %c in CONFIRMED_FINISHED message ***\n", sender_vm_id);
-          }
-        }
-        else {
-          printf("*** IGNORING UNKNOWN MESSAGE: '%s' ***\n", msg_buffer);
-        }
-        
-        printf("Current state: sent_our_finished=%s, received_their_finished=%s\n", 
-               sent_our_finished ? "true" : "false", 
-               received_their_finished ? "true" : "false");
-        printf("===========================================\n");
-      }
-      
-      /* Reset buffer */
-      msg_pos = 0;
-      memset(msg_buffer, 0, sizeof(msg_buffer));
-    } else if ((size_t)msg_pos < sizeof(msg_buffer) - 1) {
-      msg_buffer[msg_pos++] = c;
-    }
-  }
-  
-  /* Check if both players are done and we have confirmation */
-  if (sent_our_finished && received_their_finished) {
-    confirmation_wait_timer++;
-    printf("Both players finished! Waiting for stability... (%d/60)\n", confirmation_wait_timer);
-    
-    /* Wait for 60 ticks (1 second) to ensure both players are synchronized */
-    if (confirmation_wait_timer >= 60) {
-      printf("=== BOTH PLAYERS CONFIRMED FINISHED - SHOWING MULTIPLAYER RESULTS ===\n");
-      
-      /* Set results ready flag */
-      mp_results_ready = true;
-      
-      /* Reset multiplayer mode flag but keep results data */
-      is_multiplayer_mode = false;
-      waiting_initialized = false;
-      
-      /* Transition to multiplayer results screen */
-      set_game_state(STATE_MP_RESULTS);
-      
-      return 0;
-    }
-  }
-  
   /* Draw waiting screen */
   uint16_t center_x = h_res / 2;
   uint16_t center_y = v_res / 2;
@@ -1340,20 +1010,12 @@ int draw_mp_waiting_for_other_player() {
   if (draw_string_scaled(your_x, center_y - 40, your_status, green, 1) != 0) return 1;
   
   /* Show other player status with more detail */
-  if (received_their_finished) {
-    if (confirmation_wait_timer > 0) {
-      const char *sync_status = "Both players finished! Synchronizing results...";
-      uint32_t sync_color = green;
-      uint16_t sync_width = strlen(sync_status) * 8;
-      uint16_t sync_x = center_x - sync_width / 2;
-      if (draw_string_scaled(sync_x, center_y - 10, sync_status, sync_color, 1) != 0) return 1;
-    } else {
-      const char *ready_status = "Other player has also finished!";
-      uint32_t ready_color = green;
-      uint16_t ready_width = strlen(ready_status) * 8;
-      uint16_t ready_x = center_x - ready_width / 2;
-      if (draw_string_scaled(ready_x, center_y - 10, ready_status, ready_color, 1) != 0) return 1;
-    }
+  if (mp_opponent_finished()) {
+    const char *ready_status = "Other player has also finished!";
+    uint32_t ready_color = green;
+    uint16_t ready_width = strlen(ready_status) * 8;
+    uint16_t ready_x = center_x - ready_width / 2;
+    if (draw_string_scaled(ready_x, center_y - 10, ready_status, ready_color, 1) != 0) return 1;
   } else {
     const char *waiting_status = "Other player is still playing...";
     uint32_t waiting_color = yellow;
@@ -1364,10 +1026,8 @@ int draw_mp_waiting_for_other_player() {
   
   /* Show connection status */
   char status_msg[100];
-  if (sent_our_finished && received_their_finished) {
-    sprintf(status_msg, "Synchronization: %d/60", confirmation_wait_timer);
-  } else if (sent_our_finished) {
-    sprintf(status_msg, "Sent completion signal, waiting for response...");
+  if (sent_our_finished) {
+    sprintf(status_msg, "Completion signal delivered, waiting for the other player...");
   } else {
     sprintf(status_msg, "Sending completion signal...");
   }
@@ -1377,13 +1037,8 @@ int draw_mp_waiting_for_other_player() {
   if (draw_string_scaled(status_x, center_y + 30, status_msg, white, 1) != 0) return 1;
   
   /* Animated dots to show waiting */
-  static int dot_counter = 0;
-  dot_counter++;
-  if (dot_counter >= 60) dot_counter = 0; /* Reset every second */
-  
   char dots_msg[20] = "Please wait";
-  int num_dots = (dot_counter / 15) + 1; /* 1-4 dots */
-  for (int i = 0; i < num_dots && i < 4; i++) {
+  for (int i = 0; i < mp_dots && i < 4; i++) {
     strcat(dots_msg, ".");
   }
   
@@ -1407,6 +1062,13 @@ int draw_mp_waiting_for_other_player() {
   return 0;
 }
 
+int receive_mp_results() {
+  /* The other player's GAME_FINISHED goes out again until our ACK gets through;
+   * duplicates are acknowledged until the results are left */
+  mp_redraw_on(mp_receive_connected());
+  return 0;
+}
+
 int draw_mp_results_screen() {
   /* Define colors */
   uint32_t bg_color = 0x1a1a2e;
@@ -1420,15 +1082,18 @@ int draw_mp_results_screen() {
   if (clear_screen(bg_color) != 0) return 1;
   
   /* Get our player data */
-  extern singleplayer_game_t sp_game;
   char our_initials[4];
   strncpy(our_initials, sp_game.player_initials, 3);
   our_initials[3] = '\0';
   int our_score = sp_game.total_score;
   
+  /* Their final score */
+  const char *their_initials = mp_opponent()->initials;
+  int their_score = mp_opponent()->score;
+  
   /* Determine winner/loser/tie */
-  bool we_won = our_score > mp_other_player_score;
-  bool tie = our_score == mp_other_player_score;
+  bool we_won = our_score > their_score;
+  bool tie = our_score == their_score;
   
   uint16_t center_x = h_res / 2;
   uint16_t center_y = v_res / 2;
@@ -1450,17 +1115,17 @@ int draw_mp_results_screen() {
     
     /* Show both players */
     char players_msg[100];
-    sprintf(players_msg, "%s  vs  %s", our_initials, mp_other_player_initials);
+    sprintf(players_msg, "%s  vs  %s", our_initials, their_initials);
     uint16_t players_width = strlen(players_msg) * 8 * 3;
     uint16_t players_x = center_x - players_width / 2;
     if (draw_string_scaled(players_x, 200, players_msg, gold, 3) != 0) return 1;
     
   } else {
     /* Draw WINNER/LOSER screen */
-    const char *winner_initials = we_won ? our_initials : mp_other_player_initials;
-    const char *loser_initials = we_won ? mp_other_player_initials : our_initials;
-    int winner_score = we_won ? our_score : mp_other_player_score;
-    int loser_score = we_won ? mp_other_player_score : our_score;
+    const char *winner_initials = we_won ? our_initials : their_initials;
+    const char *loser_initials = we_won ? their_initials : our_initials;
+    int winner_score = we_won ? our_score : their_score;
+    int loser_score = we_won ? their_score : our_score;
     
     /* Title */
     const char *title = "GAME RESULTS";
@@ -4,22 +4,8 @@
 #include <lcom/lcf.h>
 #include <stdint.h>
 #include <stdbool.h>
-
-/* Game states */
-typedef enum {
-  STATE_MAIN_MENU,
-  STATE_SINGLE_PLAYER,
-  STATE_MULTIPLAYER,
-  STATE_MULTIPLAYER_TEST,
-  STATE_MP_WAITING_FOR_OTHER_PLAYER,
-  STATE_MP_RESULTS,
-  STATE_LEADERBOARD,
-  STATE_INSTRUCTIONS,
-  STATE_SP_ENTER_INITIALS,
-  STATE_SP_COUNTDOWN,
-  STATE_SP_LETTER_RAIN,
-  STATE_SP_PLAYING
-} game_state_t;
+#include "states.h"
+#include "multiplayer.h"
 
 /**
  * @brief Maps the VRAM to the process's address space
@@ -176,19 +162,62 @@ int draw_instructions_with_mouse(uint16_t mouse_x, uint16_t mouse_y);
 int handle_instructions_click(uint16_t x, uint16_t y, bool left_click);
 
 /**
- * @brief Initialize single player game
+ * @brief Draw single player setup page
  * 
  * @return 0 on success, non-zero otherwise
  */
 int draw_init_sp_game();
 
 /**
- * @brief Initialize multiplayer game
+ * @brief Initialize multiplayer game (resets the session and opens the serial port)
+ * 
+ * @return 0 on success, non-zero if the serial port could not be opened
+ */
+int init_mp_game();
+
+/**
+ * @brief Draw multiplayer setup page (only visible when the serial port failed)
  * 
  * @return 0 on success, non-zero otherwise
  */
 int draw_init_mp_game();
 
+/**
+ * @brief Start the multiplayer connection test (flushes the link and sends CONNECT)
+ */
+void start_multiplayer_test();
+
+/**
+ * @brief Process serial messages received during the connection test
+ * 
+ * @return 0 on success, non-zero otherwise
+ */
+int receive_multiplayer_test();
+
+/**
+ * @brief Process serial messages received while a multiplayer game is played
+ * 
+ * @return 0 on success, non-zero otherwise
+ */
+int receive_mp_game();
+
+/**
+ * @brief Serve the link during a 2 player game (retransmits, live progress)
+ */
+void update_mp_game();
+
+/**
+ * @brief Send our score and word count if they changed (at most MP_PROGRESS_RATE_HZ times per second)
+ */
+void send_mp_progress();
+
+/**
+ * @brief Get the other player's live progress
+ * 
+ * @return Progress, NULL when not in multiplayer mode
+ */
+const mp_progress_t *get_mp_opponent_progress();
+
 /**
  * @brief Draw multiplayer connection waiting screen
  * 
@@ -196,6 +225,32 @@ int draw_init_mp_game();
  */
 int draw_multiplayer_test_screen();
 
+/**
+ * @brief Advance the multiplayer connection test (retransmits, timers)
+ * 
+ * @return 0 on success, non-zero otherwise
+ */
+int update_multiplayer_test();
+
+/**
+ * @brief Start waiting for the other player (sends GAME_FINISHED)
+ */
+void start_mp_waiting_for_other_player();
+
+/**
+ * @brief Process serial messages received while waiting for the other player
+ * 
+ * @return 0 on success, non-zero otherwise
+ */
+int receive_mp_waiting_for_other_player();
+
+/**
+ * @brief Advance the waiting for other player state (retransmits, timers)
+ * 
+ * @return 0 on success, non-zero otherwise
+ */
+int update_mp_waiting_for_other_player();
+
 /**
  * @brief Draw waiting for other player screen
  * 
@@ -203,6 +258,14 @@ int draw_multiplayer_test_screen();
  */
 int draw_mp_waiting_for_other_player();
 
+/**
+ * @brief Process serial messages received on the results screen (acknowledges the
+ * other player's retransmitted GAME_FINISHED)
+ * 
+ * @return 0 on success, non-zero otherwise
+ */
+int receive_mp_results();
+
 /**
  * @brief Draw multiplayer results screen
  * 
@@ -276,29 +339,6 @@ int draw_menu_option_hover(uint16_t x, uint16_t y, uint16_t width, uint16_t heig
  */
 int draw_main_page_with_hover(uint16_t mouse_x, uint16_t mouse_y);
 
-/**
- * @brief Get current game state
- * 
- * @return Current game state
- */
-game_state_t get_game_state();
-
-/**
- * @brief Set game state
- * 
- * @param state New game state
- */
-void set_game_state(game_state_t state);
-
-/**
- * @brief Draw current page based on game state
- * 
- * @param mouse_x Current mouse X position
- * @param mouse_y Current mouse Y position
- * @return 0 on success, non-zero otherwise
- */
-int draw_current_page(uint16_t mouse_x, uint16_t mouse_y);
-
 /**
  * @brief Check if a point is inside a rectangle
  * 
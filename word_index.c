@@ -0,0 +1,135 @@
+#include "word_index.h"
+#include <stdio.h>
+#include "alloc_stats.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Bit-parallel (Myers/Hyyro) pattern of a key: positions of every byte value */
+typedef struct {
+  uint64_t peq[256];
+  uint64_t high; /* Bit of the last pattern character */
+  int length;
+} wi_pattern_t;
+
+static int pattern_init(wi_pattern_t *p, const char *key) {
+  size_t length = strlen(key);
+  if (length > WI_MAX_KEY) return 1;
+
+  memset(p->peq, 0, sizeof(p->peq));
+  for (size_t i = 0; i < length; i++) p->peq[(unsigned char) key[i]] |= (uint64_t) 1 << i;
+  p->length = (int) length;
+  p->high = length ? (uint64_t) 1 << (length - 1) : 0;
+  return 0;
+}
+
+/* Global edit distance between the pattern and a text, one column per text character */
+static int pattern_distance(const wi_pattern_t *p, const char *text) {
+  if (p->length == 0) return (int) strlen(text);
+
+  uint64_t pv = ~(uint64_t) 0, mv = 0;
+  int distance = p->length;
+  for (; *text; text++) {
+    uint64_t eq = p->peq[(unsigned char) *text];
+    uint64_t xv = eq | mv;
+    uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+
+    if (ph & p->high) distance++;
+    else if (mh & p->high) distance--;
+
+    ph = (ph << 1) | 1;
+    mh <<= 1;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+  }
+  return distance;
+}
+
+int word_index_distance(const char *a, const char *b) {
+  wi_pattern_t p;
+  if (pattern_init(&p, a) != 0) return -1;
+  return pattern_distance(&p, b);
+}
+
+int word_index_build(word_index_t *index, int count, const char *(*key)(int word)) {
+  memset(index, 0, sizeof(*index));
+  if (count <= 0) return 1;
+
+  index->nodes = tracked_malloc((size_t) count * sizeof(wi_node_t));
+  index->stack = tracked_malloc((size_t) count * sizeof(int32_t));
+  if (index->nodes == NULL || index->stack == NULL) {
+    printf("word_index_build(): out of memory for %d words\n", count);
+    word_index_free(index);
+    return 1;
+  }
+  index->word_count = count;
+  index->key = key;
+
+  wi_pattern_t p;
+  for (int w = 0; w < count; w++) {
+    wi_node_t *node = &index->nodes[w];
+    node->first_child = -1;
+    node->next_sibling = -1;
+    node->distance = 0;
+    if (pattern_init(&p, key(w)) != 0) {
+      printf("word_index_build(): key of word %d is too long\n", w);
+      word_index_free(index);
+      return 1;
+    }
+    if (w == 0) continue;
+
+    /* Walk down the edges whose distance matches, hang the word where none does */
+    int32_t parent = 0;
+    for (;;) {
+      int d = pattern_distance(&p, key(parent));
+      int32_t child = index->nodes[parent].first_child;
+      while (child >= 0 && index->nodes[child].distance != d) child = index->nodes[child].next_sibling;
+      if (child < 0) {
+        node->distance = (uint8_t) d;
+        node->next_sibling = index->nodes[parent].first_child;
+        index->nodes[parent].first_child = w;
+        break;
+      }
+      parent = child;
+    }
+  }
+  return 0;
+}
+
+void word_index_free(word_index_t *index) {
+  tracked_free(index->nodes);
+  tracked_free(index->stack);
+  index->nodes = NULL;
+  index->stack = NULL;
+  index->word_count = 0;
+}
+
+int word_index_search(word_index_t *index, const char *key, int k, wi_result_t *results, int max_results) {
+  index->visited = 0;
+  wi_pattern_t p;
+  if (index->word_count == 0 || pattern_init(&p, key) != 0) return 0;
+
+  /* Every node is pushed at most once, so the stack never holds more than word_count */
+  int found = 0, top = 0;
+  index->stack[top++] = 0;
+  while (top > 0) {
+    int32_t w = index->stack[--top];
+    int d = pattern_distance(&p, index->key(w));
+    index->visited++;
+
+    if (d <= k) {
+      if (found < max_results) {
+        results[found].word = w;
+        results[found].distance = d;
+      }
+      found++;
+    }
+
+    for (int32_t child = index->nodes[w].first_child; child >= 0; child = index->nodes[child].next_sibling) {
+      int edge = index->nodes[child].distance;
+      if (edge >= d - k && edge <= d + k) index->stack[top++] = child;
+    }
+  }
+  return found;
+}
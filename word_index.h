@@ -0,0 +1,78 @@
+#ifndef _WORD_INDEX_H_
+#define _WORD_INDEX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define WI_MAX_KEY 63  /* Longest key (bit vector width of the distance) */
+
+/**
+ * @brief BK-tree node, one per word (node i is word i, word 0 is the root)
+ */
+typedef struct {
+  int32_t first_child;  /* -1 if none */
+  int32_t next_sibling; /* -1 if none */
+  uint8_t distance;     /* Edit distance to the parent */
+} wi_node_t;
+
+/**
+ * @brief Word found by a search
+ */
+typedef struct {
+  int word;
+  int distance;
+} wi_result_t;
+
+/**
+ * @brief Metric (BK-tree) index over the keys of a word list
+ *
+ * A subtree whose edge distance differs from the query distance by more than k
+ * cannot hold a word within k (triangle inequality), so searches skip it.
+ */
+typedef struct {
+  int word_count;
+  const char *(*key)(int word); /* Normalized key of a word */
+  wi_node_t *nodes;
+  int32_t *stack;               /* Pending nodes of a search */
+  int visited;                  /* Distances computed by the last search */
+} word_index_t;
+
+/**
+ * @brief Build the index of a word list
+ *
+ * @param index Index
+ * @param count Number of words
+ * @param key Returns the normalized key of a word, valid while the index is used
+ * @return 0 on success, 1 if out of memory or a key is longer than WI_MAX_KEY
+ */
+int word_index_build(word_index_t *index, int count, const char *(*key)(int word));
+
+/**
+ * @brief Release the memory of an index
+ *
+ * @param index Index
+ */
+void word_index_free(word_index_t *index);
+
+/**
+ * @brief Find every word within edit distance k of a key
+ *
+ * @param index Index
+ * @param key Normalized key (at most WI_MAX_KEY characters)
+ * @param k Maximum edit distance
+ * @param results Returns the words found, in no particular order
+ * @param max_results Capacity of results
+ * @return Number of words found (may exceed max_results, only max_results are stored)
+ */
+int word_index_search(word_index_t *index, const char *key, int k, wi_result_t *results, int max_results);
+
+/**
+ * @brief Edit distance between two keys
+ *
+ * @param a Key of at most WI_MAX_KEY characters
+ * @param b Any key
+ * @return Levenshtein distance
+ */
+int word_index_distance(const char *a, const char *b);
+
+#endif /* _WORD_INDEX_H_ */
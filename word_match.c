@@ -0,0 +1,167 @@
+#include "word_match.h"
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+/* Normalized form of a typed or dictionary character, -1 if it is not a letter */
+static int letter_index(char c) {
+  int l = tolower((unsigned char) c);
+  return (l >= 'a' && l <= 'z') ? l - 'a' : -1;
+}
+
+/* Child of a trie node for a character, -1 if there is none */
+static int16_t trie_child(const word_matcher_t *m, int16_t node, char c) {
+  for (int16_t n = m->nodes[node].first_child; n >= 0; n = m->nodes[n].next_sibling) {
+    if (m->nodes[n].c == c) return n;
+  }
+  return -1;
+}
+
+static int trie_insert(word_matcher_t *m, const char *word, int index) {
+  int16_t node = 0;
+  for (int i = 0; word[i]; i++) {
+    int16_t child = trie_child(m, node, word[i]);
+    if (child < 0) {
+      if (m->node_count >= WM_MAX_NODES) return 1;
+      child = (int16_t) m->node_count++;
+      m->nodes[child].c = word[i];
+      m->nodes[child].first_child = -1;
+      m->nodes[child].word = -1;
+      m->nodes[child].next_sibling = m->nodes[node].first_child;
+      m->nodes[node].first_child = child;
+    }
+    node = child;
+  }
+  if (m->nodes[node].word < 0) m->nodes[node].word = (int16_t) index;
+  return 0;
+}
+
+/* Closest word and the set of close words for the vectors at a depth */
+static void update_matches(word_matcher_t *m, int depth) {
+  uint32_t close = 0;
+  int best = -1;
+  for (int w = 0; w < m->word_count; w++) {
+    uint8_t d = m->vectors[depth][w].distance;
+    if (d > WM_MAX_DISTANCE) continue;
+    close |= (uint32_t) 1 << w;
+    if (best < 0 || d < m->vectors[depth][best].distance) best = w;
+  }
+  m->close_mask[depth] = close;
+  m->best[depth] = (int8_t) best;
+}
+
+int word_matcher_init(word_matcher_t *m, const dict_category_t *category) {
+  memset(m, 0, sizeof(*m));
+  m->nodes[0].first_child = -1;
+  m->nodes[0].next_sibling = -1;
+  m->nodes[0].word = -1;
+  m->node_count = 1;
+
+  if (category->word_count > WM_MAX_WORDS) return 1;
+  m->word_count = (int) category->word_count;
+
+  for (int w = 0; w < m->word_count; w++) {
+    /* Keys are already normalized: lowercase, no accents */
+    const dict_word_t *entry = dictionary_word(category, w);
+    const char *key = dictionary_string(entry->key);
+    if (entry->key_len == 0 || entry->key_len > WM_MAX_KEY) return 1;
+    m->length[w] = entry->key_len;
+
+    for (int i = 0; i < entry->key_len; i++) {
+      int l = letter_index(key[i]);
+      if (l >= 0) m->peq[w][l] |= (uint32_t) 1 << i;
+    }
+
+    if (trie_insert(m, key, w) != 0) {
+      printf("word_matcher_init(): trie is full\n");
+      return 1;
+    }
+  }
+
+  word_matcher_reset(m);
+  return 0;
+}
+
+void word_matcher_reset(word_matcher_t *m) {
+  m->depth = 0;
+  m->cursor[0] = 0;
+
+  /* Empty input: distance to each word is its length */
+  for (int w = 0; w < m->word_count; w++) {
+    m->vectors[0][w].pv = ((uint32_t) 1 << m->length[w]) - 1;
+    m->vectors[0][w].mv = 0;
+    m->vectors[0][w].distance = m->length[w];
+  }
+  update_matches(m, 0);
+}
+
+int word_matcher_push(word_matcher_t *m, char c) {
+  if (m->depth >= WM_MAX_INPUT) return 1;
+
+  int depth = m->depth + 1;
+  int l = letter_index(c);
+
+  /* Trie cursor follows the exact prefix */
+  int16_t node = m->cursor[depth - 1];
+  m->cursor[depth] = (node >= 0 && l >= 0) ? trie_child(m, node, (char) ('a' + l)) : -1;
+
+  /* One DP column per word; global distance, so the top row grows by one per character */
+  for (int w = 0; w < m->word_count; w++) {
+    const wm_vector_t *prev = &m->vectors[depth - 1][w];
+    wm_vector_t *next = &m->vectors[depth][w];
+    uint32_t eq = (l >= 0) ? m->peq[w][l] : 0;
+    uint32_t pv = prev->pv, mv = prev->mv;
+    uint32_t high = (uint32_t) 1 << (m->length[w] - 1);
+
+    uint32_t xv = eq | mv;
+    uint32_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint32_t ph = mv | ~(xh | pv);
+    uint32_t mh = pv & xh;
+
+    next->distance = prev->distance;
+    if (ph & high) next->distance++;
+    else if (mh & high) next->distance--;
+
+    ph = (ph << 1) | 1;
+    mh <<= 1;
+    next->pv = mh | ~(xv | ph);
+    next->mv = ph & xv;
+  }
+
+  m->depth = depth;
+  update_matches(m, depth);
+  return 0;
+}
+
+void word_matcher_pop(word_matcher_t *m) {
+  if (m->depth > 0) m->depth--;
+}
+
+int word_matcher_resolve(const word_matcher_t *m, uint32_t exclude) {
+  int best = m->best[m->depth];
+  if (best < 0) return -1;
+  if (!(exclude & ((uint32_t) 1 << best))) return best;
+
+  /* Closest word is excluded: only another word just as close may stand in,
+   * a repeated answer must not score its neighbour ("junho" again is not "julho") */
+  uint8_t distance = m->vectors[m->depth][best].distance;
+  uint32_t close = m->close_mask[m->depth] & ~exclude;
+  for (; close != 0; close &= close - 1) {
+    int w = __builtin_ctz(close);
+    if (m->vectors[m->depth][w].distance == distance) return w;
+  }
+  return -1;
+}
+
+uint32_t word_matcher_close_words(const word_matcher_t *m) {
+  return m->close_mask[m->depth];
+}
+
+int word_matcher_distance(const word_matcher_t *m, int word) {
+  if (word < 0 || word >= m->word_count) return -1;
+  return m->vectors[m->depth][word].distance;
+}
+
+bool word_matcher_on_prefix(const word_matcher_t *m) {
+  return m->cursor[m->depth] >= 0;
+}
@@ -0,0 +1,120 @@
+#ifndef _WORD_MATCH_H_
+#define _WORD_MATCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "dictionary.h"
+
+#define WM_MAX_WORDS 32                            /* Largest category matched per keystroke */
+#define WM_MAX_INPUT 32                            /* Longest input tracked */
+#define WM_MAX_KEY 31                              /* Longest word key (bit vector width) */
+#define WM_MAX_NODES (WM_MAX_WORDS * WM_MAX_KEY + 1) /* Trie nodes for a full category */
+#define WM_MAX_DISTANCE 1                          /* Typos accepted in a word */
+
+/**
+ * @brief Trie node (first-child/next-sibling), index 0 is the root
+ */
+typedef struct {
+  char c;               /* Normalized character leading to this node */
+  int16_t first_child;  /* -1 if none */
+  int16_t next_sibling; /* -1 if none */
+  int16_t word;         /* Index of the word ending here, -1 if none */
+} wm_trie_node_t;
+
+/**
+ * @brief Bit-parallel (Myers/Hyyro) edit distance column of one word
+ */
+typedef struct {
+  uint32_t pv, mv;   /* Vertical +1/-1 deltas of the DP column */
+  uint8_t distance;  /* Edit distance between the word and the whole input */
+} wm_vector_t;
+
+/**
+ * @brief Matching state of one category, updated one keystroke at a time
+ */
+typedef struct {
+  /* Compiled category */
+  int word_count;
+  uint8_t length[WM_MAX_WORDS];        /* Normalized word lengths */
+  uint32_t peq[WM_MAX_WORDS][26];      /* Positions of each letter 'a'..'z' in each word */
+  wm_trie_node_t nodes[WM_MAX_NODES];
+  int node_count;
+
+  /* One entry per input length, so removing a character is a pop */
+  int depth;                                         /* Characters in the input */
+  int16_t cursor[WM_MAX_INPUT + 1];                  /* Trie node of the input, -1 if it left the trie */
+  wm_vector_t vectors[WM_MAX_INPUT + 1][WM_MAX_WORDS];
+  uint32_t close_mask[WM_MAX_INPUT + 1];             /* Words within WM_MAX_DISTANCE of the input */
+  int8_t best[WM_MAX_INPUT + 1];                     /* Closest word (lowest index on ties), -1 if none close */
+} word_matcher_t;
+
+/**
+ * @brief Compile the words of a category and start with an empty input
+ *
+ * @param m Matcher
+ * @param category Category whose words are the candidates
+ * @return 0 on success, 1 if the category is too large or a word does not fit the bit vectors
+ */
+int word_matcher_init(word_matcher_t *m, const dict_category_t *category);
+
+/**
+ * @brief Forget the input, keeping the compiled category
+ *
+ * @param m Matcher
+ */
+void word_matcher_reset(word_matcher_t *m);
+
+/**
+ * @brief Append a typed character, updating the trie cursor and every distance vector
+ *
+ * @param m Matcher
+ * @param c Character (any case)
+ * @return 0 on success, 1 if the input is too long
+ */
+int word_matcher_push(word_matcher_t *m, char c);
+
+/**
+ * @brief Remove the last typed character
+ *
+ * @param m Matcher
+ */
+void word_matcher_pop(word_matcher_t *m);
+
+/**
+ * @brief Get the word the current input resolves to
+ *
+ * The closest word wins; when it is in exclude, another word is only used if
+ * it is exactly as close, so a repeated answer does not resolve to a neighbour.
+ *
+ * @param m Matcher
+ * @param exclude Words that cannot be the result (bit i = word i), e.g. already answered ones
+ * @return Word index, -1 if the closest words are all excluded or none is close enough
+ */
+int word_matcher_resolve(const word_matcher_t *m, uint32_t exclude);
+
+/**
+ * @brief Get the words close enough to the current input to be accepted
+ *
+ * @param m Matcher
+ * @return Bit i set if word i is within WM_MAX_DISTANCE
+ */
+uint32_t word_matcher_close_words(const word_matcher_t *m);
+
+/**
+ * @brief Get the edit distance between the input and a word
+ *
+ * @param m Matcher
+ * @param word Word index
+ * @return Edit distance
+ */
+int word_matcher_distance(const word_matcher_t *m, int word);
+
+/**
+ * @brief Check if the input is exactly the start of some word
+ *
+ * @param m Matcher
+ * @return True while the trie cursor is still on the trie
+ */
+bool word_matcher_on_prefix(const word_matcher_t *m);
+
+#endif /* _WORD_MATCH_H_ */